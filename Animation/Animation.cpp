@@ -0,0 +1,40 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Animation.hpp"
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	Animation::Animation()
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	Animation::~Animation()
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	AnimationCompletedEvent& Animation::GetCompletedEvent()
+	{
+		return completedEvent_;
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	void Animation::Reset()
+	{
+
+	}
+	//---------------------------------------------------------------------------
+}
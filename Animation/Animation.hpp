@@ -0,0 +1,81 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_ANIMATION_ANIMATION_HPP
+#define OSHGUI_ANIMATION_ANIMATION_HPP
+
+#include "../Exports.hpp"
+#include "../Misc/Clock.hpp"
+#include "../Event/Event.hpp"
+
+namespace OSHGui
+{
+	class Control;
+	class Animation;
+
+	/**
+	 * Tritt ein, wenn eine Animation ihr Ende erreicht hat.
+	 */
+	typedef Event<void(Animation*)> AnimationCompletedEvent;
+	typedef EventHandler<void(Animation*)> AnimationCompletedEventHandler;
+
+	/**
+	 * Basisklasse für Animationen, die vom Animator mit der Zeit des Frames fortgeschrieben werden.
+	 */
+	class OSHGUI_EXPORT Animation
+	{
+	public:
+		virtual ~Animation();
+
+		/**
+		 * Ruft die Gesamtdauer der Animation ab.
+		 *
+		 * \return duration, Duration::max() bei endloser Wiederholung
+		 */
+		virtual Misc::Clock::Duration GetDuration() const = 0;
+		/**
+		 * Ruft ab, ob die Animation das Steuerelement verändert.
+		 *
+		 * \param control
+		 * \return ja / nein
+		 */
+		virtual bool Affects(const Control *control) const = 0;
+
+		/**
+		 * Wird beim (erneuten) Start der Animation aufgerufen.
+		 */
+		virtual void Reset();
+		/**
+		 * Setzt die animierten Werte auf den Stand zum angegebenen Zeitpunkt.
+		 *
+		 * \param elapsed Zeit seit dem Start der Animation
+		 * \return false, falls die Animation beendet ist
+		 */
+		virtual bool Update(const Misc::Clock::Duration &elapsed) = 0;
+
+		/**
+		 * Ruft das CompletedEvent der Animation ab. Es wird nicht ausgelöst, wenn die
+		 * Animation vorzeitig angehalten wird.
+		 *
+		 * \return completedEvent
+		 */
+		AnimationCompletedEvent& GetCompletedEvent();
+
+	protected:
+		Animation();
+
+	private:
+		//copying prohibited
+		Animation(const Animation&);
+		void operator=(const Animation&);
+
+		AnimationCompletedEvent completedEvent_;
+	};
+}
+
+#endif
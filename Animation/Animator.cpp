@@ -0,0 +1,123 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Animator.hpp"
+#include "../Misc/Exceptions.hpp"
+#include <algorithm>
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	Animator::Animator()
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	bool Animator::IsRunning(const std::shared_ptr<Animation> &animation) const
+	{
+		return std::any_of(std::begin(entries_), std::end(entries_), [&animation](const Entry &entry)
+		{
+			return entry.Item == animation;
+		});
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	void Animator::Start(const std::shared_ptr<Animation> &animation)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (!animation)
+		{
+			throw Misc::ArgumentNullException("animation");
+		}
+		#endif
+
+		for (auto &entry : entries_)
+		{
+			if (entry.Item == animation)
+			{
+				entry.Started = false;
+				return;
+			}
+		}
+
+		Entry entry = { animation, Misc::Clock::TimePoint(), false };
+		entries_.push_back(entry);
+	}
+	//---------------------------------------------------------------------------
+	void Animator::Stop(const std::shared_ptr<Animation> &animation)
+	{
+		//während Process nur markieren, entfernt wird am Ende von Process
+		for (auto &entry : entries_)
+		{
+			if (entry.Item == animation)
+			{
+				entry.Item = nullptr;
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Animator::Cancel(const Control *control)
+	{
+		for (auto &entry : entries_)
+		{
+			if (entry.Item && entry.Item->Affects(control))
+			{
+				entry.Item = nullptr;
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Animator::Process(const Misc::Clock::TimePoint &now)
+	{
+		//CompletedEvent-Handler dürfen weitere Animationen starten, daher über den Index iterieren
+		for (std::size_t i = 0; i < entries_.size(); ++i)
+		{
+			if (!entries_[i].Item)
+			{
+				continue;
+			}
+
+			if (!entries_[i].Started)
+			{
+				entries_[i].Start = now;
+				entries_[i].Started = true;
+				entries_[i].Item->Reset();
+			}
+
+			auto animation = entries_[i].Item;
+			if (!animation->Update(now - entries_[i].Start))
+			{
+				//im Eintrag könnte inzwischen eine neu gestartete Animation stehen
+				if (entries_[i].Item == animation && entries_[i].Started)
+				{
+					entries_[i].Item = nullptr;
+					animation->GetCompletedEvent().Invoke(animation.get());
+				}
+			}
+		}
+
+		entries_.erase(std::remove_if(std::begin(entries_), std::end(entries_), [](const Entry &entry)
+		{
+			return !entry.Item;
+		}), std::end(entries_));
+	}
+	//---------------------------------------------------------------------------
+	void Animator::Shift(const Misc::Clock::Duration &offset)
+	{
+		for (auto &entry : entries_)
+		{
+			entry.Start += offset;
+		}
+	}
+	//---------------------------------------------------------------------------
+}
@@ -0,0 +1,85 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_ANIMATION_ANIMATOR_HPP
+#define OSHGUI_ANIMATION_ANIMATOR_HPP
+
+#include <memory>
+#include <vector>
+#include "Animation.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Schreibt die laufenden Animationen mit der Zeit des Frames fort. Wird von
+	 * Application::Render aufgerufen.
+	 */
+	class OSHGUI_EXPORT Animator
+	{
+	public:
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		Animator();
+
+		/**
+		 * Startet die Animation mit dem nächsten Frame. Läuft sie bereits, beginnt sie von vorne.
+		 *
+		 * \param animation
+		 */
+		void Start(const std::shared_ptr<Animation> &animation);
+		/**
+		 * Hält die Animation an. Die animierten Werte bleiben auf dem aktuellen Stand.
+		 *
+		 * \param animation
+		 */
+		void Stop(const std::shared_ptr<Animation> &animation);
+		/**
+		 * Hält alle Animationen an, die das Steuerelement verändern.
+		 *
+		 * \param control
+		 */
+		void Cancel(const Control *control);
+		/**
+		 * Ruft ab, ob die Animation läuft.
+		 *
+		 * \param animation
+		 * \return ja / nein
+		 */
+		bool IsRunning(const std::shared_ptr<Animation> &animation) const;
+
+		/**
+		 * Schreibt alle laufenden Animationen fort und entfernt die beendeten.
+		 *
+		 * \param now die aktuelle Zeit
+		 */
+		void Process(const Misc::Clock::TimePoint &now);
+		/**
+		 * Verschiebt die Startzeitpunkte, z.B. nach einem Wechsel der Zeitquelle.
+		 *
+		 * \param offset
+		 */
+		void Shift(const Misc::Clock::Duration &offset);
+
+	private:
+		//copying prohibited
+		Animator(const Animator&);
+		void operator=(const Animator&);
+
+		struct Entry
+		{
+			std::shared_ptr<Animation> Item;
+			Misc::Clock::TimePoint Start;
+			bool Started;
+		};
+
+		std::vector<Entry> entries_;
+	};
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Easing.hpp"
+#include <cmath>
+
+namespace OSHGui
+{
+	namespace Easing
+	{
+		namespace
+		{
+			const float Pi = 3.14159265358979f;
+		}
+		//---------------------------------------------------------------------------
+		float Linear(float t)
+		{
+			return t;
+		}
+		//---------------------------------------------------------------------------
+		float QuadIn(float t)
+		{
+			return t * t;
+		}
+		//---------------------------------------------------------------------------
+		float QuadOut(float t)
+		{
+			return t * (2.0f - t);
+		}
+		//---------------------------------------------------------------------------
+		float QuadInOut(float t)
+		{
+			return t < 0.5f ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t;
+		}
+		//---------------------------------------------------------------------------
+		float CubicIn(float t)
+		{
+			return t * t * t;
+		}
+		//---------------------------------------------------------------------------
+		float CubicOut(float t)
+		{
+			const auto u = t - 1.0f;
+			return u * u * u + 1.0f;
+		}
+		//---------------------------------------------------------------------------
+		float CubicInOut(float t)
+		{
+			if (t < 0.5f)
+			{
+				return 4.0f * t * t * t;
+			}
+			const auto u = 2.0f * t - 2.0f;
+			return 0.5f * u * u * u + 1.0f;
+		}
+		//---------------------------------------------------------------------------
+		float SineIn(float t)
+		{
+			return 1.0f - std::cos(t * Pi * 0.5f);
+		}
+		//---------------------------------------------------------------------------
+		float SineOut(float t)
+		{
+			return std::sin(t * Pi * 0.5f);
+		}
+		//---------------------------------------------------------------------------
+		float SineInOut(float t)
+		{
+			return 0.5f * (1.0f - std::cos(t * Pi));
+		}
+		//---------------------------------------------------------------------------
+		float BackOut(float t)
+		{
+			const auto s = 1.70158f;
+			const auto u = t - 1.0f;
+			return u * u * ((s + 1.0f) * u + s) + 1.0f;
+		}
+		//---------------------------------------------------------------------------
+		float BounceOut(float t)
+		{
+			if (t < 1.0f / 2.75f)
+			{
+				return 7.5625f * t * t;
+			}
+			if (t < 2.0f / 2.75f)
+			{
+				t -= 1.5f / 2.75f;
+				return 7.5625f * t * t + 0.75f;
+			}
+			if (t < 2.5f / 2.75f)
+			{
+				t -= 2.25f / 2.75f;
+				return 7.5625f * t * t + 0.9375f;
+			}
+			t -= 2.625f / 2.75f;
+			return 7.5625f * t * t + 0.984375f;
+		}
+		//---------------------------------------------------------------------------
+		float ElasticOut(float t)
+		{
+			if (t <= 0.0f || t >= 1.0f)
+			{
+				return t;
+			}
+			return std::pow(2.0f, -10.0f * t) * std::sin((t - 0.075f) * (2.0f * Pi) / 0.3f) + 1.0f;
+		}
+		//---------------------------------------------------------------------------
+	}
+}
@@ -0,0 +1,56 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_ANIMATION_EASING_HPP
+#define OSHGUI_ANIMATION_EASING_HPP
+
+#include "../Exports.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Bildet den linearen Fortschritt (0 bis 1) einer Animation auf den gewünschten Verlauf ab.
+	 */
+	typedef float (*EasingFunction)(float t);
+
+	/**
+	 * Die üblichen Easing-Kurven. In beschleunigt am Anfang, Out bremst am Ende ab,
+	 * InOut macht beides.
+	 */
+	namespace Easing
+	{
+		OSHGUI_EXPORT float Linear(float t);
+
+		OSHGUI_EXPORT float QuadIn(float t);
+		OSHGUI_EXPORT float QuadOut(float t);
+		OSHGUI_EXPORT float QuadInOut(float t);
+
+		OSHGUI_EXPORT float CubicIn(float t);
+		OSHGUI_EXPORT float CubicOut(float t);
+		OSHGUI_EXPORT float CubicInOut(float t);
+
+		OSHGUI_EXPORT float SineIn(float t);
+		OSHGUI_EXPORT float SineOut(float t);
+		OSHGUI_EXPORT float SineInOut(float t);
+
+		/**
+		 * Schießt kurz über das Ziel hinaus und kehrt dann zurück.
+		 */
+		OSHGUI_EXPORT float BackOut(float t);
+		/**
+		 * Springt am Ende wie ein fallender Ball aus.
+		 */
+		OSHGUI_EXPORT float BounceOut(float t);
+		/**
+		 * Schwingt am Ende wie eine Feder aus.
+		 */
+		OSHGUI_EXPORT float ElasticOut(float t);
+	}
+}
+
+#endif
@@ -0,0 +1,130 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Timeline.hpp"
+#include "../Misc/Exceptions.hpp"
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	Timeline::Timeline()
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	Misc::Clock::Duration Timeline::GetDuration() const
+	{
+		auto duration = Misc::Clock::Duration::zero();
+		for (auto &entry : entries_)
+		{
+			const auto length = entry.Item->GetDuration();
+			if (length == Misc::Clock::Duration::max())
+			{
+				return Misc::Clock::Duration::max();
+			}
+			if (entry.Begin + length > duration)
+			{
+				duration = entry.Begin + length;
+			}
+		}
+		return duration;
+	}
+	//---------------------------------------------------------------------------
+	bool Timeline::Affects(const Control *control) const
+	{
+		for (auto &entry : entries_)
+		{
+			if (entry.Item->Affects(control))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	void Timeline::Add(const std::shared_ptr<Animation> &animation, const Misc::Clock::Duration &begin)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (!animation)
+		{
+			throw Misc::ArgumentNullException("animation");
+		}
+		if (begin < Misc::Clock::Duration::zero())
+		{
+			throw Misc::ArgumentOutOfRangeException("begin");
+		}
+		#endif
+
+		Entry entry = { animation, begin, false, false };
+		entries_.push_back(entry);
+	}
+	//---------------------------------------------------------------------------
+	void Timeline::Append(const std::shared_ptr<Animation> &animation)
+	{
+		const auto begin = GetDuration();
+
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (begin == Misc::Clock::Duration::max())
+		{
+			throw Misc::InvalidOperationException("Cannot append to a timeline containing an infinite animation.");
+		}
+		#endif
+
+		Add(animation, begin);
+	}
+	//---------------------------------------------------------------------------
+	void Timeline::Reset()
+	{
+		for (auto &entry : entries_)
+		{
+			entry.Started = false;
+			entry.Finished = false;
+		}
+	}
+	//---------------------------------------------------------------------------
+	bool Timeline::Update(const Misc::Clock::Duration &elapsed)
+	{
+		auto running = false;
+		for (auto &entry : entries_)
+		{
+			if (entry.Finished)
+			{
+				continue;
+			}
+			if (elapsed < entry.Begin)
+			{
+				running = true;
+				continue;
+			}
+
+			if (!entry.Started)
+			{
+				entry.Item->Reset();
+				entry.Started = true;
+			}
+
+			if (entry.Item->Update(elapsed - entry.Begin))
+			{
+				running = true;
+			}
+			else
+			{
+				entry.Finished = true;
+				entry.Item->GetCompletedEvent().Invoke(entry.Item.get());
+			}
+		}
+		return running;
+	}
+	//---------------------------------------------------------------------------
+}
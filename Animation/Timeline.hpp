@@ -0,0 +1,60 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_ANIMATION_TIMELINE_HPP
+#define OSHGUI_ANIMATION_TIMELINE_HPP
+
+#include <memory>
+#include <vector>
+#include "Animation.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Fasst mehrere Animationen mit festen Startzeitpunkten zusammen. Die Timeline ist
+	 * beendet, sobald alle enthaltenen Animationen beendet sind.
+	 */
+	class OSHGUI_EXPORT Timeline : public Animation
+	{
+	public:
+		Timeline();
+
+		/**
+		 * Fügt eine Animation hinzu, die zum angegebenen Zeitpunkt startet.
+		 *
+		 * \param animation
+		 * \param begin Startzeitpunkt relativ zum Start der Timeline
+		 */
+		void Add(const std::shared_ptr<Animation> &animation, const Misc::Clock::Duration &begin);
+		/**
+		 * Fügt eine Animation hinzu, die startet, nachdem alle bisherigen beendet sind.
+		 *
+		 * \param animation
+		 */
+		void Append(const std::shared_ptr<Animation> &animation);
+
+		virtual Misc::Clock::Duration GetDuration() const override;
+		virtual bool Affects(const Control *control) const override;
+
+		virtual void Reset() override;
+		virtual bool Update(const Misc::Clock::Duration &elapsed) override;
+
+	private:
+		struct Entry
+		{
+			std::shared_ptr<Animation> Item;
+			Misc::Clock::Duration Begin;
+			bool Started;
+			bool Finished;
+		};
+
+		std::vector<Entry> entries_;
+	};
+}
+
+#endif
@@ -0,0 +1,165 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Tween.hpp"
+#include "../Controls/Control.hpp"
+#include "../Misc/Exceptions.hpp"
+
+namespace OSHGui
+{
+	namespace
+	{
+		float Lerp(float from, float to, float t)
+		{
+			return from + (to - from) * t;
+		}
+	}
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	Tween::Tween(Control *target, const Misc::Clock::Duration &duration, EasingFunction easing, const Setter &setter)
+		: target_(target),
+		  duration_(duration),
+		  easing_(easing),
+		  setter_(setter),
+		  repeatCount_(1),
+		  autoReverse_(false)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (duration < Misc::Clock::Duration::zero())
+		{
+			throw Misc::ArgumentOutOfRangeException("duration");
+		}
+		if (easing == nullptr)
+		{
+			throw Misc::ArgumentNullException("easing");
+		}
+		if (!setter)
+		{
+			throw Misc::ArgumentNullException("setter");
+		}
+		#endif
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	void Tween::SetRepeatCount(int count)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (count < 1 && count != Infinite)
+		{
+			throw Misc::ArgumentOutOfRangeException("count");
+		}
+		#endif
+
+		repeatCount_ = count;
+	}
+	//---------------------------------------------------------------------------
+	int Tween::GetRepeatCount() const
+	{
+		return repeatCount_;
+	}
+	//---------------------------------------------------------------------------
+	void Tween::SetAutoReverse(bool autoReverse)
+	{
+		autoReverse_ = autoReverse;
+	}
+	//---------------------------------------------------------------------------
+	bool Tween::GetAutoReverse() const
+	{
+		return autoReverse_;
+	}
+	//---------------------------------------------------------------------------
+	Misc::Clock::Duration Tween::GetDuration() const
+	{
+		if (repeatCount_ == Infinite)
+		{
+			return Misc::Clock::Duration::max();
+		}
+		return duration_ * (autoReverse_ ? 2 : 1) * repeatCount_;
+	}
+	//---------------------------------------------------------------------------
+	bool Tween::Affects(const Control *control) const
+	{
+		return target_ != nullptr && target_ == control;
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	bool Tween::Update(const Misc::Clock::Duration &elapsed)
+	{
+		const auto finalProgress = autoReverse_ ? 0.0f : 1.0f;
+
+		if (duration_ == Misc::Clock::Duration::zero() || (repeatCount_ != Infinite && elapsed >= GetDuration()))
+		{
+			setter_(easing_(finalProgress));
+			return false;
+		}
+
+		auto position = elapsed % (duration_ * (autoReverse_ ? 2 : 1));
+		auto reverse = false;
+		if (position >= duration_)
+		{
+			position -= duration_;
+			reverse = true;
+		}
+
+		auto progress = static_cast<float>(position.count()) / static_cast<float>(duration_.count());
+		if (reverse)
+		{
+			progress = 1.0f - progress;
+		}
+
+		setter_(easing_(progress));
+
+		return true;
+	}
+	//---------------------------------------------------------------------------
+	std::shared_ptr<Tween> Tween::Opacity(Control *control, float from, float to, const Misc::Clock::Duration &duration, EasingFunction easing)
+	{
+		return std::make_shared<Tween>(control, duration, easing, [control, from, to](float t)
+		{
+			control->SetOpacity(Lerp(from, to, t));
+		});
+	}
+	//---------------------------------------------------------------------------
+	std::shared_ptr<Tween> Tween::RenderOffset(Control *control, const Drawing::PointF &from, const Drawing::PointF &to, const Misc::Clock::Duration &duration, EasingFunction easing)
+	{
+		return std::make_shared<Tween>(control, duration, easing, [control, from, to](float t)
+		{
+			control->SetRenderOffset(Drawing::PointF(Lerp(from.X, to.X, t), Lerp(from.Y, to.Y, t)));
+		});
+	}
+	//---------------------------------------------------------------------------
+	std::shared_ptr<Tween> Tween::RenderScale(Control *control, float from, float to, const Misc::Clock::Duration &duration, EasingFunction easing)
+	{
+		return std::make_shared<Tween>(control, duration, easing, [control, from, to](float t)
+		{
+			//Kurven wie BackOut schießen über das Ziel hinaus, die Skalierung darf trotzdem nicht negativ werden
+			auto scale = Lerp(from, to, t);
+			control->SetRenderScale(scale < 0.0f ? 0.0f : scale);
+		});
+	}
+	//---------------------------------------------------------------------------
+	std::shared_ptr<Tween> Tween::ForeColor(Control *control, const Drawing::Color &from, const Drawing::Color &to, const Misc::Clock::Duration &duration, EasingFunction easing)
+	{
+		return std::make_shared<Tween>(control, duration, easing, [control, from, to](float t)
+		{
+			control->SetForeColor(Drawing::Color(Lerp(from.GetAlpha(), to.GetAlpha(), t), Lerp(from.GetRed(), to.GetRed(), t), Lerp(from.GetGreen(), to.GetGreen(), t), Lerp(from.GetBlue(), to.GetBlue(), t)));
+		});
+	}
+	//---------------------------------------------------------------------------
+	std::shared_ptr<Tween> Tween::BackColor(Control *control, const Drawing::Color &from, const Drawing::Color &to, const Misc::Clock::Duration &duration, EasingFunction easing)
+	{
+		return std::make_shared<Tween>(control, duration, easing, [control, from, to](float t)
+		{
+			control->SetBackColor(Drawing::Color(Lerp(from.GetAlpha(), to.GetAlpha(), t), Lerp(from.GetRed(), to.GetRed(), t), Lerp(from.GetGreen(), to.GetGreen(), t), Lerp(from.GetBlue(), to.GetBlue(), t)));
+		});
+	}
+	//---------------------------------------------------------------------------
+}
@@ -0,0 +1,104 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_ANIMATION_TWEEN_HPP
+#define OSHGUI_ANIMATION_TWEEN_HPP
+
+#include <memory>
+#include "Animation.hpp"
+#include "Easing.hpp"
+#include "../Event/Delegate.hpp"
+#include "../Drawing/Point.hpp"
+#include "../Drawing/Color.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Animiert einen Wert von 0 bis 1 über die angegebene Dauer und übergibt ihn nach
+	 * Anwendung der Easing-Funktion an den Setter.
+	 */
+	class OSHGUI_EXPORT Tween : public Animation
+	{
+	public:
+		typedef Delegate<void(float)> Setter;
+
+		static const int Infinite = -1;
+
+		/**
+		 * Konstruktor der Klasse.
+		 *
+		 * \param target das veränderte Steuerelement (darf nullptr sein)
+		 * \param duration Dauer eines Durchlaufs
+		 * \param easing
+		 * \param setter erhält den Fortschritt nach Anwendung der Easing-Funktion
+		 */
+		Tween(Control *target, const Misc::Clock::Duration &duration, EasingFunction easing, const Setter &setter);
+
+		/**
+		 * Legt fest, wie oft die Animation durchlaufen wird.
+		 *
+		 * \param count Anzahl oder Infinite
+		 */
+		void SetRepeatCount(int count);
+		/**
+		 * Ruft ab, wie oft die Animation durchlaufen wird.
+		 *
+		 * \return count
+		 */
+		int GetRepeatCount() const;
+		/**
+		 * Legt fest, ob jeder Durchlauf nach dem Ende rückwärts zum Anfang läuft.
+		 * Ein Durchlauf dauert dann doppelt so lange.
+		 *
+		 * \param autoReverse
+		 */
+		void SetAutoReverse(bool autoReverse);
+		/**
+		 * Ruft ab, ob jeder Durchlauf rückwärts zum Anfang läuft.
+		 *
+		 * \return autoReverse
+		 */
+		bool GetAutoReverse() const;
+
+		virtual Misc::Clock::Duration GetDuration() const override;
+		virtual bool Affects(const Control *control) const override;
+
+		virtual bool Update(const Misc::Clock::Duration &elapsed) override;
+
+		/**
+		 * Blendet das Steuerelement über die Deckkraft ein oder aus.
+		 */
+		static std::shared_ptr<Tween> Opacity(Control *control, float from, float to, const Misc::Clock::Duration &duration, EasingFunction easing = Easing::QuadInOut);
+		/**
+		 * Verschiebt das Steuerelement beim Zeichnen, ohne das Layout zu verändern.
+		 */
+		static std::shared_ptr<Tween> RenderOffset(Control *control, const Drawing::PointF &from, const Drawing::PointF &to, const Misc::Clock::Duration &duration, EasingFunction easing = Easing::QuadInOut);
+		/**
+		 * Skaliert das Steuerelement beim Zeichnen um seinen Mittelpunkt.
+		 */
+		static std::shared_ptr<Tween> RenderScale(Control *control, float from, float to, const Misc::Clock::Duration &duration, EasingFunction easing = Easing::QuadInOut);
+		/**
+		 * Ändert die Fordergrundfarbe. Die Geometrie des Steuerelements wird dabei in jedem Frame neu erzeugt.
+		 */
+		static std::shared_ptr<Tween> ForeColor(Control *control, const Drawing::Color &from, const Drawing::Color &to, const Misc::Clock::Duration &duration, EasingFunction easing = Easing::QuadInOut);
+		/**
+		 * Ändert die Hintergrundfarbe. Die Geometrie des Steuerelements wird dabei in jedem Frame neu erzeugt.
+		 */
+		static std::shared_ptr<Tween> BackColor(Control *control, const Drawing::Color &from, const Drawing::Color &to, const Misc::Clock::Duration &duration, EasingFunction easing = Easing::QuadInOut);
+
+	private:
+		Control *target_;
+		Misc::Clock::Duration duration_;
+		EasingFunction easing_;
+		Setter setter_;
+		int repeatCount_;
+		bool autoReverse_;
+	};
+}
+
+#endif
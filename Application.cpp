@@ -1,412 +1,704 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#include "Application.hpp"
-#include "Controls/Form.hpp"
-#include "Misc/Exceptions.hpp"
-#include "FormManager.hpp"
-#include "Drawing/FontManager.hpp"
-#include "Cursor/Cursors.hpp"
-#include <algorithm>
-
-namespace OSHGui
-{
-	Application* Application::instance = nullptr;
-	//---------------------------------------------------------------------------
-	Application::Application(std::unique_ptr<Drawing::Renderer> &&renderer)
-		: renderer_(std::move(renderer)),
-		  guiSurface_(*renderer_->GetDefaultRenderTarget()),
-		  now_(Misc::DateTime::GetNow()),
-		  FocusedControl(nullptr),
-		  CaptureControl(nullptr),
-		  MouseEnteredControl(nullptr),
-		  isEnabled_(false)
-	{
-		Drawing::Style style;
-
-		#define MakeStyle(type, color1, color2) style.SetControlStyle(type, { color1, color2 })
-
-		MakeStyle(ControlType::Label,		Drawing::Color::White(), Drawing::Color::Empty());
-		MakeStyle(ControlType::LinkLabel,	Drawing::Color::White(), Drawing::Color::Empty());
-		MakeStyle(ControlType::Button,		Drawing::Color::White(), Drawing::Color(0xFF4E4E4E));
-		MakeStyle(ControlType::CheckBox,	Drawing::Color::White(), Drawing::Color(0xFF222222));
-		MakeStyle(ControlType::RadioButton, Drawing::Color::White(), Drawing::Color(0xFF222222));
-		MakeStyle(ControlType::ColorBar,	Drawing::Color::White(), Drawing::Color::Empty());
-		MakeStyle(ControlType::ColorPicker,	Drawing::Color::Empty(),	Drawing::Color::Empty());
-		MakeStyle(ControlType::ComboBox,	Drawing::Color::White(), Drawing::Color(0xFF4E4E4E));
-		MakeStyle(ControlType::Form,		Drawing::Color::White(), Drawing::Color(0xFF7C7B79));
-		MakeStyle(ControlType::GroupBox,	Drawing::Color::White(), Drawing::Color::Empty());
-		MakeStyle(ControlType::ListBox,		Drawing::Color::White(), Drawing::Color(0xFF171614));
-		MakeStyle(ControlType::Panel,		Drawing::Color::Empty(),	Drawing::Color::Empty());
-		MakeStyle(ControlType::PictureBox,	Drawing::Color::Empty(),	Drawing::Color::Empty());
-		MakeStyle(ControlType::ProgressBar,	Drawing::Color(0xFF5A5857),	Drawing::Color::Empty());
-		MakeStyle(ControlType::ScrollBar,	Drawing::Color(0xFFAFADAD), Drawing::Color(0xFF585552));
-		MakeStyle(ControlType::TabControl,	Drawing::Color::White(), Drawing::Color(0xFF737373));
-		MakeStyle(ControlType::TabPage,		Drawing::Color::White(), Drawing::Color(0xFF474747));
-		MakeStyle(ControlType::TextBox,		Drawing::Color::White(), Drawing::Color(0xFF242321));
-		MakeStyle(ControlType::TrackBar,	Drawing::Color::White(), Drawing::Color::Empty());
-		MakeStyle(ControlType::HotkeyControl, Drawing::Color::White(), Drawing::Color(0xFF242321));
-
-		SetStyle(style);
-	}
-	//---------------------------------------------------------------------------
-	Application& Application::Instance()
-	{
-		return *instance;
-	}
-	//---------------------------------------------------------------------------
-	Application* Application::InstancePtr()
-	{
-		return instance;
-	}
-	//---------------------------------------------------------------------------
-	bool Application::HasBeenInitialized()
-	{
-		return InstancePtr() != nullptr;
-	}
-	//---------------------------------------------------------------------------
-	void Application::Initialize(std::unique_ptr<Drawing::Renderer> &&renderer)
-	{
-		#ifndef OSHGUI_DONTUSEEXCEPTIONS
-		if (HasBeenInitialized())
-		{
-			throw Misc::InvalidOperationException("only one instance allowed");
-		}
-		#endif
-
-		instance = new Application(std::move(renderer));
-
-		instance->mouse_.Enabled = true;
-		instance->SetCursor(Cursors::Get(Cursors::Default));
-	}
-	//---------------------------------------------------------------------------
-	bool Application::IsEnabled() const
-	{
-		return isEnabled_;
-	}
-	//---------------------------------------------------------------------------
-	const Misc::DateTime& Application::GetNow() const
-	{
-		return now_;
-	}
-	//---------------------------------------------------------------------------
-	Drawing::Renderer& Application::GetRenderer() const
-	{
-		return *renderer_;
-	}
-	//---------------------------------------------------------------------------
-	Application::GuiRenderSurface& Application::GetRenderSurface()
-	{
-		return guiSurface_;
-	}
-	//---------------------------------------------------------------------------
-	Drawing::FontPtr& Application::GetDefaultFont()
-	{
-		return defaultFont_;
-	}
-	//---------------------------------------------------------------------------
-	void Application::SetDefaultFont(const Drawing::FontPtr &defaultFont)
-	{
-		defaultFont_ = defaultFont;
-
-		guiSurface_.Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	const Drawing::PointF& Application::GetCursorLocation() const
-	{
-		return mouse_.Location;
-	}
-	//---------------------------------------------------------------------------
-	const std::shared_ptr<Cursor>& Application::GetCursor() const
-	{
-		return mouse_.Cursor;
-	}
-	//---------------------------------------------------------------------------
-	void Application::SetCursor(const CursorPtr &cursor)
-	{
-		mouse_.Cursor = cursor ? cursor : Cursors::Get(Cursors::Default);
-
-		guiSurface_.Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	void Application::SetCursorEnabled(bool enabled)
-	{
-		mouse_.Enabled = enabled;
-
-		guiSurface_.Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	void Application::SetStyle(const Drawing::Style &style)
-	{
-		_currentStyle = style;
-		for (auto it = formManager_.GetEnumerator(); it(); ++it)
-		{
-			auto &form = *it;
-			form->ApplyStyle(style);
-		}
-	}
-	//---------------------------------------------------------------------------
-	const Drawing::Style& Application::GetStyle() const
-	{
-		return _currentStyle;
-	}
-	//---------------------------------------------------------------------------
-	void Application::Enable()
-	{
-		isEnabled_ = true;
-
-		auto mainForm = formManager_.GetMainForm();
-		if (mainForm != nullptr)
-		{
-			if (!formManager_.IsRegistered(mainForm))
-			{
-				mainForm->Show(mainForm);
-			}
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Application::Disable()
-	{
-		isEnabled_ = false;
-	}
-	//---------------------------------------------------------------------------
-	void Application::Toggle()
-	{
-		if (isEnabled_)
-		{
-			Disable();
-		}
-		else
-		{
-			Enable();
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Application::Run(const std::shared_ptr<Form> &mainForm)
-	{
-		#ifndef OSHGUI_DONTUSEEXCEPTIONS
-		if (mainForm == nullptr)
-		{
-			throw Misc::ArgumentNullException("form");
-		}
-		#endif
-
-		if (formManager_.GetMainForm() != nullptr)
-		{
-			return;
-		}
-		
-		formManager_.RegisterMainForm(mainForm);
-
-		mainForm->Show(mainForm);
-	}
-	//---------------------------------------------------------------------------
-	bool Application::ProcessMouseMessage(const MouseMessage &message)
-	{
-		if (!isEnabled_)
-		{
-			return false;
-		}
-
-		mouse_.Location = message.GetLocation();
-
-		if (CaptureControl != nullptr)
-		{
-			CaptureControl->ProcessMouseMessage(message);
-			return true;
-		}
-		if (FocusedControl != nullptr)
-		{
-			if (FocusedControl->ProcessMouseMessage(message))
-			{
-				return true;
-			}
-		}
-
-		if (formManager_.GetFormCount() > 0)
-		{
-			auto foreMost = formManager_.GetForeMost();
-			if (foreMost != nullptr && foreMost->IsModal())
-			{
-				for (auto it = foreMost->GetPostOrderEnumerator(); it(); ++it)
-				{
-					auto control = *it;
-					if (control->ProcessMouseMessage(message))
-					{
-						return true;
-					}
-				}
-				return false;
-			}
-			
-			for (auto it = formManager_.GetEnumerator(); it(); ++it)
-			{
-				auto &form = *it;
-				
-				for (auto it2 = form->GetPostOrderEnumerator(); it2(); ++it2)
-				{
-					auto control = *it2;
-					if (control->ProcessMouseMessage(message))
-					{
-						if (form != foreMost)
-						{
-							formManager_.BringToFront(form);
-						}
-
-						return true;
-					}
-				}
-			}
-
-			if (MouseEnteredControl)
-			{
-				MouseEnteredControl->OnMouseLeave(message);
-			}
-		}
-
-		return false;
-	}
-	//---------------------------------------------------------------------------
-	bool Application::ProcessKeyboardMessage(const KeyboardMessage &keyboard)
-	{
-		if (keyboard.GetState() == KeyboardState::KeyDown)
-		{
-			auto hotkeyFired = false;
-			for (auto &hotkey : hotkeys_)
-			{
-				if (hotkey.GetKey() == keyboard.GetKeyCode() && hotkey.GetModifier() == keyboard.GetModifier())
-				{
-					hotkeyFired = true;
-					hotkey();
-				}
-			}
-
-			if (hotkeyFired)
-			{
-				return true;
-			}
-		}
-
-		if (isEnabled_)
-		{
-			if (FocusedControl != nullptr)
-			{
-				return FocusedControl->ProcessKeyboardMessage(keyboard);
-			}
-		}
-
-		return false;
-	}
-	//---------------------------------------------------------------------------
-	void Application::InjectTime()
-	{
-		now_ = Misc::DateTime::GetNow();
-
-		for (auto it = formManager_.GetEnumerator(); it(); ++it)
-		{
-			(*it)->InjectTime(now_);
-
-			for (auto it2 = (*it)->GetPostOrderEnumerator(); it2(); ++it2)
-			{
-				(*it2)->InjectTime(now_);
-			}
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Application::DisplaySizeChanged(const Drawing::SizeF &size)
-	{
-		Drawing::FontManager::DisplaySizeChanged(size);
-
-		renderer_->SetDisplaySize(size);
-	}
-	//---------------------------------------------------------------------------
-	void Application::Render()
-	{
-		if (!isEnabled_)
-		{
-			return;
-		}
-		
-		InjectTime();
-
-		//Drawing::TextureAnimator::UpdateFrames();
-
-		formManager_.RemoveUnregisteredForms();
-
-		if (guiSurface_.needsRedraw_)
-		{
-			auto foreMost = formManager_.GetForeMost();
-			for (auto it = formManager_.GetEnumerator(); it(); ++it)
-			{
-				auto &form = *it;
-				if (form != foreMost)
-				{
-					form->Render();
-				}
-			}
-			if (foreMost)
-			{
-				foreMost->Render();
-			}
-
-			if (mouse_.Enabled)
-			{
-				guiSurface_.AddGeometry(Drawing::RenderQueueType::Overlay, mouse_.Cursor->GetGeometry());
-			}
-
-			guiSurface_.needsRedraw_ = false;
-		}
-
-		if (mouse_.Enabled)
-		{
-			mouse_.Cursor->GetGeometry()->SetTranslation(Drawing::Vector(mouse_.Location.X, mouse_.Location.Y, 0));
-		}
-
-		guiSurface_.Draw();
-	}
-	//---------------------------------------------------------------------------
-	void Application::RegisterHotkey(const Hotkey &hotkey)
-	{
-		UnregisterHotkey(hotkey);
-
-		hotkeys_.push_back(hotkey);
-	}
-	//---------------------------------------------------------------------------
-	void Application::UnregisterHotkey(const Hotkey &hotkey)
-	{
-		hotkeys_.erase(std::remove(std::begin(hotkeys_), std::end(hotkeys_), hotkey), std::end(hotkeys_));
-	}
-	//---------------------------------------------------------------------------
-	//Application::GuiRenderSurface
-	//---------------------------------------------------------------------------
-	Application::GuiRenderSurface::GuiRenderSurface(Drawing::RenderTarget &target)
-		: RenderSurface(target),
-		  needsRedraw_(true)
-	{
-
-	}
-	//---------------------------------------------------------------------------
-	void Application::GuiRenderSurface::Invalidate()
-	{
-		needsRedraw_ = true;
-
-		Reset();
-	}
-	//---------------------------------------------------------------------------
-	void Application::GuiRenderSurface::Draw()
-	{
-		if (needsRedraw_)
-		{
-
-		}
-
-		RenderSurface::Draw();
-	}
-	//---------------------------------------------------------------------------
-
-}
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Application.hpp"
+#include "Controls/Form.hpp"
+#include "Misc/Exceptions.hpp"
+#include "FormManager.hpp"
+#include "Drawing/FontManager.hpp"
+#include "Cursor/Cursors.hpp"
+#include "Input/InputRecorder.hpp"
+#include <algorithm>
+
+namespace OSHGui
+{
+	Application* Application::instance = nullptr;
+	//---------------------------------------------------------------------------
+	Application::Application(std::unique_ptr<Drawing::Renderer> &&renderer)
+		: renderer_(std::move(renderer)),
+		  guiSurface_(*renderer_->GetDefaultRenderTarget()),
+		  dispatchQueue_(DispatchQueueCapacity),
+		  now_(Misc::DateTime::GetNow()),
+		  clock_(std::make_shared<Misc::SteadyClock>()),
+		  time_(clock_->GetNow()),
+		  hasPendingInput_(false),
+		  FocusedControl(nullptr),
+		  CaptureControl(nullptr),
+		  MouseEnteredControl(nullptr),
+		  isEnabled_(false),
+		  updateDepth_(0),
+		  hasPendingInvalidations_(false),
+		  hasPendingLocations_(false)
+	{
+		Drawing::Style style;
+
+		#define MakeStyle(type, color1, color2) style.SetControlStyle(type, { color1, color2, nullptr })
+
+		MakeStyle(ControlType::Label,		Drawing::Color::White(), Drawing::Color::Empty());
+		MakeStyle(ControlType::LinkLabel,	Drawing::Color::White(), Drawing::Color::Empty());
+		MakeStyle(ControlType::Button,		Drawing::Color::White(), Drawing::Color(0xFF4E4E4E));
+		MakeStyle(ControlType::CheckBox,	Drawing::Color::White(), Drawing::Color(0xFF222222));
+		MakeStyle(ControlType::RadioButton, Drawing::Color::White(), Drawing::Color(0xFF222222));
+		MakeStyle(ControlType::ColorBar,	Drawing::Color::White(), Drawing::Color::Empty());
+		MakeStyle(ControlType::ColorPicker,	Drawing::Color::Empty(),	Drawing::Color::Empty());
+		MakeStyle(ControlType::ComboBox,	Drawing::Color::White(), Drawing::Color(0xFF4E4E4E));
+		MakeStyle(ControlType::Form,		Drawing::Color::White(), Drawing::Color(0xFF7C7B79));
+		MakeStyle(ControlType::GroupBox,	Drawing::Color::White(), Drawing::Color::Empty());
+		MakeStyle(ControlType::ListBox,		Drawing::Color::White(), Drawing::Color(0xFF171614));
+		MakeStyle(ControlType::ListView,	Drawing::Color::White(), Drawing::Color(0xFF171614));
+		MakeStyle(ControlType::Panel,		Drawing::Color::Empty(),	Drawing::Color::Empty());
+		MakeStyle(ControlType::PictureBox,	Drawing::Color::Empty(),	Drawing::Color::Empty());
+		MakeStyle(ControlType::ProgressBar,	Drawing::Color(0xFF5A5857),	Drawing::Color::Empty());
+		MakeStyle(ControlType::ScrollBar,	Drawing::Color(0xFFAFADAD), Drawing::Color(0xFF585552));
+		MakeStyle(ControlType::ScrollPanel,	Drawing::Color::Empty(),	Drawing::Color::Empty());
+		MakeStyle(ControlType::TabControl,	Drawing::Color::White(), Drawing::Color(0xFF737373));
+		MakeStyle(ControlType::TabPage,		Drawing::Color::White(), Drawing::Color(0xFF474747));
+		MakeStyle(ControlType::TextBox,		Drawing::Color::White(), Drawing::Color(0xFF242321));
+		MakeStyle(ControlType::MultiLineTextBox, Drawing::Color::White(), Drawing::Color(0xFF242321));
+		MakeStyle(ControlType::TrackBar,	Drawing::Color::White(), Drawing::Color::Empty());
+		MakeStyle(ControlType::HotkeyControl, Drawing::Color::White(), Drawing::Color(0xFF242321));
+
+		SetStyle(style);
+	}
+	//---------------------------------------------------------------------------
+	Application& Application::Instance()
+	{
+		return *instance;
+	}
+	//---------------------------------------------------------------------------
+	Application* Application::InstancePtr()
+	{
+		return instance;
+	}
+	//---------------------------------------------------------------------------
+	bool Application::HasBeenInitialized()
+	{
+		return InstancePtr() != nullptr;
+	}
+	//---------------------------------------------------------------------------
+	void Application::Initialize(std::unique_ptr<Drawing::Renderer> &&renderer)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (HasBeenInitialized())
+		{
+			throw Misc::InvalidOperationException("only one instance allowed");
+		}
+		#endif
+
+		instance = new Application(std::move(renderer));
+
+		instance->mouse_.Enabled = true;
+		instance->SetCursor(Cursors::Get(Cursors::Default));
+	}
+	//---------------------------------------------------------------------------
+	bool Application::IsEnabled() const
+	{
+		return isEnabled_;
+	}
+	//---------------------------------------------------------------------------
+	const Misc::DateTime& Application::GetNow() const
+	{
+		return now_;
+	}
+	//---------------------------------------------------------------------------
+	const Misc::Clock::TimePoint& Application::GetTime() const
+	{
+		return time_;
+	}
+	//---------------------------------------------------------------------------
+	void Application::SetClock(const std::shared_ptr<Misc::Clock> &clock)
+	{
+		clock_ = clock ? clock : std::make_shared<Misc::SteadyClock>();
+
+		//geplante Zeitpunkte in die neue Zeitbasis übertragen
+		const auto now = clock_->GetNow();
+		timerScheduler_.Shift(now - time_);
+		animator_.Shift(now - time_);
+		time_ = now;
+	}
+	//---------------------------------------------------------------------------
+	Misc::Clock& Application::GetClock() const
+	{
+		return *clock_;
+	}
+	//---------------------------------------------------------------------------
+	const std::shared_ptr<Misc::Clock>& Application::GetSharedClock() const
+	{
+		return clock_;
+	}
+	//---------------------------------------------------------------------------
+	Animator& Application::GetAnimator()
+	{
+		return animator_;
+	}
+	//---------------------------------------------------------------------------
+	Drawing::Renderer& Application::GetRenderer() const
+	{
+		return *renderer_;
+	}
+	//---------------------------------------------------------------------------
+	Application::GuiRenderSurface& Application::GetRenderSurface()
+	{
+		return guiSurface_;
+	}
+	//---------------------------------------------------------------------------
+	Drawing::FontPtr& Application::GetDefaultFont()
+	{
+		return defaultFont_;
+	}
+	//---------------------------------------------------------------------------
+	void Application::SetDefaultFont(const Drawing::FontPtr &defaultFont)
+	{
+		defaultFont_ = defaultFont;
+
+		guiSurface_.Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::PointF& Application::GetCursorLocation() const
+	{
+		return mouse_.Location;
+	}
+	//---------------------------------------------------------------------------
+	const std::shared_ptr<Cursor>& Application::GetCursor() const
+	{
+		return mouse_.Cursor;
+	}
+	//---------------------------------------------------------------------------
+	void Application::SetCursor(const CursorPtr &cursor)
+	{
+		mouse_.Cursor = cursor ? cursor : Cursors::Get(Cursors::Default);
+
+		guiSurface_.Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void Application::SetCursorEnabled(bool enabled)
+	{
+		mouse_.Enabled = enabled;
+
+		guiSurface_.Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void Application::SetInputRecorder(const std::shared_ptr<Input::InputRecorder> &recorder)
+	{
+		inputRecorder_ = recorder;
+	}
+	//---------------------------------------------------------------------------
+	const std::shared_ptr<Input::InputRecorder>& Application::GetInputRecorder() const
+	{
+		return inputRecorder_;
+	}
+	//---------------------------------------------------------------------------
+	void Application::SetStyle(const Drawing::Style &style)
+	{
+		UpdateScope update;
+
+		_currentStyle = style;
+		for (auto it = formManager_.GetEnumerator(); it(); ++it)
+		{
+			auto &form = *it;
+			form->ApplyStyle(style);
+		}
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::Style& Application::GetStyle() const
+	{
+		return _currentStyle;
+	}
+	//---------------------------------------------------------------------------
+	void Application::UpdateStyle(const Drawing::Style &style)
+	{
+		UpdateScope update;
+
+		const auto previous = std::move(_currentStyle);
+		_currentStyle = style;
+		for (auto it = formManager_.GetEnumerator(); it(); ++it)
+		{
+			auto &form = *it;
+			form->ApplyStyleChanges(previous, _currentStyle);
+		}
+	}
+	//---------------------------------------------------------------------------
+	bool Application::LoadTheme(const Misc::AnsiString &file, bool watch)
+	{
+		themeWatcher_.SetFile(watch ? file : Misc::AnsiString());
+
+		Drawing::Theme theme;
+		if (!theme.Load(file))
+		{
+			return false;
+		}
+
+		UpdateStyle(theme.ToStyle());
+
+		return true;
+	}
+	//---------------------------------------------------------------------------
+	void Application::BeginUpdate()
+	{
+		++updateDepth_;
+	}
+	//---------------------------------------------------------------------------
+	void Application::EndUpdate()
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (updateDepth_ == 0)
+		{
+			throw Misc::InvalidOperationException("EndUpdate without BeginUpdate");
+		}
+		#endif
+
+		if (--updateDepth_ == 0)
+		{
+			FlushInvalidations();
+		}
+	}
+	//---------------------------------------------------------------------------
+	bool Application::IsUpdating() const
+	{
+		return updateDepth_ > 0;
+	}
+	//---------------------------------------------------------------------------
+	void Application::Enable()
+	{
+		isEnabled_ = true;
+
+		auto mainForm = formManager_.GetMainForm();
+		if (mainForm != nullptr)
+		{
+			if (!formManager_.IsRegistered(mainForm))
+			{
+				mainForm->Show(mainForm);
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Application::Disable()
+	{
+		isEnabled_ = false;
+	}
+	//---------------------------------------------------------------------------
+	void Application::Toggle()
+	{
+		if (isEnabled_)
+		{
+			Disable();
+		}
+		else
+		{
+			Enable();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Application::Run(const std::shared_ptr<Form> &mainForm)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (mainForm == nullptr)
+		{
+			throw Misc::ArgumentNullException("form");
+		}
+		#endif
+
+		if (formManager_.GetMainForm() != nullptr)
+		{
+			return;
+		}
+		
+		formManager_.RegisterMainForm(mainForm);
+
+		mainForm->Show(mainForm);
+	}
+	//---------------------------------------------------------------------------
+	bool Application::ProcessMouseMessage(const MouseMessage &message)
+	{
+		if (inputRecorder_)
+		{
+			inputRecorder_->RecordMouseMessage(message);
+		}
+
+		if (!isEnabled_)
+		{
+			return false;
+		}
+
+		RecordInput(message.GetTimestamp());
+
+		mouse_.Location = message.GetLocation();
+
+		//Verschiebungen seit der letzten Nachricht für den Hit-Test übernehmen
+		UpdatePendingLocations();
+
+		if (CaptureControl != nullptr)
+		{
+			CaptureControl->ProcessMouseMessage(message);
+			return true;
+		}
+		if (FocusedControl != nullptr)
+		{
+			if (FocusedControl->ProcessMouseMessage(message))
+			{
+				return true;
+			}
+		}
+
+		if (formManager_.GetFormCount() > 0)
+		{
+			auto foreMost = formManager_.GetForeMost();
+			if (foreMost != nullptr && foreMost->IsModal())
+			{
+				return ProcessMouseMessage(*foreMost, message);
+			}
+			
+			for (auto it = formManager_.GetEnumerator(); it(); ++it)
+			{
+				auto &form = *it;
+				
+				if (ProcessMouseMessage(*form, message))
+				{
+					if (form != foreMost)
+					{
+						formManager_.BringToFront(form);
+					}
+
+					return true;
+				}
+			}
+
+			if (MouseEnteredControl)
+			{
+				MouseEnteredControl->OnMouseLeave(message);
+			}
+		}
+
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	bool Application::ProcessMouseMessage(Form &form, const MouseMessage &message)
+	{
+		if (message.GetState() == MouseState::Scroll)
+		{
+			//Scroll-Nachrichten gehen auch an fokussierte Steuerelemente außerhalb des Cursors
+			for (auto it = form.GetPostOrderEnumerator(); it(); ++it)
+			{
+				auto control = *it;
+				if (control->ProcessMouseMessage(message))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		form.GetControlsAtPoint(message.GetLocation(), hitTestControls_);
+		for (auto control : hitTestControls_)
+		{
+			if (control->ProcessMouseMessage(message))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	bool Application::ProcessKeyboardMessage(const KeyboardMessage &keyboard)
+	{
+		if (inputRecorder_)
+		{
+			inputRecorder_->RecordKeyboardMessage(keyboard);
+		}
+
+		if (isEnabled_)
+		{
+			RecordInput(keyboard.GetTimestamp());
+		}
+
+		if (keyboard.GetState() == KeyboardState::KeyDown)
+		{
+			auto hotkeyFired = false;
+			for (auto &hotkey : hotkeys_)
+			{
+				if (hotkey.GetKey() == keyboard.GetKeyCode() && hotkey.GetModifier() == keyboard.GetModifier())
+				{
+					hotkeyFired = true;
+					hotkey();
+				}
+			}
+
+			if (hotkeyFired)
+			{
+				return true;
+			}
+		}
+
+		if (isEnabled_)
+		{
+			if (FocusedControl != nullptr)
+			{
+				return FocusedControl->ProcessKeyboardMessage(keyboard);
+			}
+		}
+
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	void Application::InjectTime()
+	{
+		now_ = Misc::DateTime::GetNow();
+		time_ = clock_->GetNow();
+
+		timerScheduler_.Process(time_);
+		animator_.Process(time_);
+	}
+	//---------------------------------------------------------------------------
+	void Application::DisplaySizeChanged(const Drawing::SizeF &size)
+	{
+		Drawing::FontManager::DisplaySizeChanged(size);
+
+		renderer_->SetDisplaySize(size);
+	}
+	//---------------------------------------------------------------------------
+	void Application::Render()
+	{
+		//auch bei deaktiviertem GUI leeren, damit die Warteschlange nicht volläuft
+		ProcessDispatchQueue();
+
+		//auch bei deaktiviertem GUI, damit die Wiedergabe dieselben Frames sieht
+		if (inputRecorder_)
+		{
+			inputRecorder_->RecordFrame();
+		}
+
+		if (!isEnabled_)
+		{
+			return;
+		}
+		
+		InjectTime();
+
+		CheckThemeFile();
+
+		//Drawing::TextureAnimator::UpdateFrames();
+
+		formManager_.RemoveUnregisteredForms();
+
+		//eine noch offene Aktualisierung darf das Zeichnen nicht verhindern
+		FlushInvalidations();
+
+		//höchstens ein Layout-Durchlauf pro Frame für alle geänderten Teilbäume
+		for (auto it = formManager_.GetEnumerator(); it(); ++it)
+		{
+			auto &form = *it;
+			if (form->isLayoutDirty_ || form->isChildLayoutDirty_)
+			{
+				form->LayoutPendingControls();
+			}
+		}
+
+		//auch die durch das Layout verschobenen Steuerelemente
+		UpdatePendingLocations();
+
+		if (guiSurface_.needsRedraw_)
+		{
+			auto foreMost = formManager_.GetForeMost();
+			for (auto it = formManager_.GetEnumerator(); it(); ++it)
+			{
+				auto &form = *it;
+				if (form != foreMost)
+				{
+					form->Render();
+				}
+			}
+			if (foreMost)
+			{
+				foreMost->Render();
+			}
+
+			if (mouse_.Enabled)
+			{
+				guiSurface_.AddGeometry(Drawing::RenderQueueType::Overlay, mouse_.Cursor->GetGeometry());
+			}
+
+			guiSurface_.needsRedraw_ = false;
+		}
+
+		if (mouse_.Enabled)
+		{
+			mouse_.Cursor->GetGeometry()->SetTranslation(Drawing::Vector(mouse_.Location.X, mouse_.Location.Y, 0));
+		}
+
+		guiSurface_.Draw();
+
+		if (hasPendingInput_)
+		{
+			hasPendingInput_ = false;
+
+			const auto latency = clock_->GetNow() - oldestPendingInput_;
+			inputLatency_.Last = latency;
+			inputLatency_.Max = std::max(inputLatency_.Max, latency);
+			inputLatency_.Total += latency;
+			++inputLatency_.Samples;
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Application::CheckThemeFile()
+	{
+		if (themeWatcher_.GetFile().empty() || time_ < nextThemeCheck_)
+		{
+			return;
+		}
+
+		nextThemeCheck_ = time_ + std::chrono::milliseconds(500);
+
+		if (themeWatcher_.HasChanged())
+		{
+			//ist die Datei ungültig oder nur halb gespeichert, bleibt der bisherige Style aktiv
+			Drawing::Theme theme;
+			if (theme.Load(themeWatcher_.GetFile()))
+			{
+				UpdateStyle(theme.ToStyle());
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Application::FlushInvalidations()
+	{
+		if (hasPendingInvalidations_)
+		{
+			hasPendingInvalidations_ = false;
+
+			guiSurface_.Invalidate();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Application::UpdatePendingLocations()
+	{
+		//CalculateAbsoluteLocation darf weitere Steuerelemente verschieben
+		while (hasPendingLocations_)
+		{
+			hasPendingLocations_ = false;
+
+			for (auto it = formManager_.GetEnumerator(); it(); ++it)
+			{
+				auto &form = *it;
+				if (form->isLocationDirty_ || form->isChildLocationDirty_)
+				{
+					form->UpdatePendingLocations();
+				}
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	const Application::InputLatency& Application::GetInputLatency() const
+	{
+		return inputLatency_;
+	}
+	//---------------------------------------------------------------------------
+	void Application::ResetInputLatency()
+	{
+		inputLatency_ = InputLatency();
+	}
+	//---------------------------------------------------------------------------
+	void Application::RecordInput(const Misc::Clock::TimePoint &timestamp)
+	{
+		//Nachrichten ohne Zeitstempel entstehen direkt hier, ihre Latenz beginnt jetzt
+		const auto time = timestamp == Misc::Clock::TimePoint() ? clock_->GetNow() : timestamp;
+		if (!hasPendingInput_ || time < oldestPendingInput_)
+		{
+			oldestPendingInput_ = time;
+			hasPendingInput_ = true;
+		}
+	}
+	//---------------------------------------------------------------------------
+	bool Application::Dispatch(Delegate<void()> function)
+	{
+		return dispatchQueue_.TryPush(std::move(function));
+	}
+	//---------------------------------------------------------------------------
+	void Application::ProcessDispatchQueue()
+	{
+		//nur so viele Funktionen wie Plätze, damit ständiges Nachschieben das Zeichnen nicht verhindert
+		Delegate<void()> function;
+		for (auto i = dispatchQueue_.GetCapacity(); i > 0 && dispatchQueue_.TryPop(function); --i)
+		{
+			function();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Application::RegisterHotkey(const Hotkey &hotkey)
+	{
+		UnregisterHotkey(hotkey);
+
+		hotkeys_.push_back(hotkey);
+	}
+	//---------------------------------------------------------------------------
+	void Application::UnregisterHotkey(const Hotkey &hotkey)
+	{
+		hotkeys_.erase(std::remove(std::begin(hotkeys_), std::end(hotkeys_), hotkey), std::end(hotkeys_));
+	}
+	//---------------------------------------------------------------------------
+	//Application::InputLatency
+	//---------------------------------------------------------------------------
+	Application::InputLatency::InputLatency()
+		: Last(0),
+		  Max(0),
+		  Total(0),
+		  Samples(0)
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	Misc::Clock::Duration Application::InputLatency::GetAverage() const
+	{
+		return Samples > 0 ? Total / static_cast<Misc::Clock::Duration::rep>(Samples) : Misc::Clock::Duration(0);
+	}
+	//---------------------------------------------------------------------------
+	//Application::UpdateScope
+	//---------------------------------------------------------------------------
+	Application::UpdateScope::UpdateScope()
+	{
+		Application::Instance().BeginUpdate();
+	}
+	//---------------------------------------------------------------------------
+	Application::UpdateScope::~UpdateScope()
+	{
+		Application::Instance().EndUpdate();
+	}
+	//---------------------------------------------------------------------------
+	//Application::GuiRenderSurface
+	//---------------------------------------------------------------------------
+	Application::GuiRenderSurface::GuiRenderSurface(Drawing::RenderTarget &target)
+		: RenderSurface(target),
+		  needsRedraw_(true)
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	void Application::GuiRenderSurface::Invalidate()
+	{
+		//die Queues wurden seit dem letzten Zeichnen bereits geleert
+		if (needsRedraw_)
+		{
+			return;
+		}
+
+		needsRedraw_ = true;
+
+		Reset();
+	}
+	//---------------------------------------------------------------------------
+	void Application::GuiRenderSurface::Draw()
+	{
+		if (needsRedraw_)
+		{
+
+		}
+
+		RenderSurface::Draw();
+	}
+	//---------------------------------------------------------------------------
+
+}
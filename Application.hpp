@@ -1,248 +1,417 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_APPLICATION_HPP
-#define OSHGUI_APPLICATION_HPP
-
-#include <memory>
-#include <vector>
-#include "Drawing/Renderer.hpp"
-#include "Drawing/RenderContext.hpp"
-#include "Drawing/Font.hpp"
-#include "Drawing/Style.hpp"
-#include "Misc/DateTime.hpp"
-#include "Cursor/Cursor.hpp"
-#include "Event/MouseMessage.hpp"
-#include "Event/KeyboardMessage.hpp"
-#include "Exports.hpp"
-#include "FormManager.hpp"
-#include "Event/Hotkey.hpp"
-
-namespace OSHGui
-{
-	class Control;
-	class Form;
-	
-	/**
-	 * Stellt Methoden und Eigenschaften fr die Verwaltung einer
-	 * Anwendung zur Verfgung, z.B. Methoden zum Starten und Beenden einer
-	 * Anwendung sowie fr das Abrufen von Informationen zu einer Anwendung.
-	 */
-	class OSHGUI_EXPORT Application
-	{
-		friend Control;
-		friend Form;
-
-	public:
-		class GuiRenderSurface;
-
-		/**
-		 * Initialisiert die Application-Klasse.
-		 *
-		 * \param renderer Instanz des verwendeten Renderers
-		 */
-		static void Initialize(std::unique_ptr<Drawing::Renderer> &&renderer);
-		
-		/**
-		 * Ruft ab, ob das GUI aktiviert ist.
-		 *
-		 * return isEnabled
-		 */
-		bool IsEnabled() const;
-		/**
-		 * Ruft die aktuelle Uhrzeit ab.
-		 *
-		 * \return DateTime::Now
-		 */
-		const Misc::DateTime& GetNow() const;
-
-		/**
-		 * Ruft den verwendeten Renderer ab.
-		 *
-		 * \return renderer
-		 */
-		Drawing::Renderer& GetRenderer() const;
-		/**
-		 * Ruft das RenderSurface der Gui ab.
-		 *
-		 * \return GuiRenderSurface
-		 */
-		GuiRenderSurface& GetRenderSurface();
-		/**
-		 * Legt die Display-Gre fest.
-		 *
-		 * @param size
-		 */
-		void DisplaySizeChanged(const Drawing::SizeF &size);
-		
-		/**
-		 * Legt die Standardschrift fr das Gui fest.
-		 *
-		 * \param font Standardschrift
-		 */
-		void SetDefaultFont(const Drawing::FontPtr &font);
-		/**
-		 * Ruft die Standardschrift fr das Gui ab.
-		 *
-		 * \return Standardschrift
-		 */
-		Drawing::FontPtr& GetDefaultFont();
-		
-		/**
-		 * Ruft die aktuelle Mausposition ab.
-		 *
-		 * \return cursorLocation
-		 */
-		const Drawing::PointF& GetCursorLocation() const;
-		/**
-		 * Ruft den Cursor ab.
-		 *
-		 * \return cursor
-		 */
-		const std::shared_ptr<Cursor>& GetCursor() const;
-		/**
-		 * Legt den Cursor fest.
-		 *
-		 * \param cursor
-		 */
-		void SetCursor(const std::shared_ptr<Cursor> &cursor);
-		/**
-		 * Legt fest, ob der Cursor gezeichnet werden soll.
-		 *
-		 * \param enabled
-		 */
-		void SetCursorEnabled(bool enabled);
-		
-		/**
-		 * Legt den Style fr das Gui fest.
-		 *
-		 * \param style
-		 */
-		void SetStyle(const Drawing::Style &style);
-		/**
-		 * Ruft den Style fr das Gui ab.
-		 *
-		 * \return style
-		 */
-		const Drawing::Style& GetStyle() const;
-	
-		/**
-		 * Aktiviert das GUI.
-		 */
-		void Enable();
-		/**
-		 * Deaktiviert das GUI.
-		 */
-		void Disable();
-		/**
-		 * Wechselt zwischen Enabled und Disabled.
-		 */
-		void Toggle();
-
-		/**
-		 * Legt die Hauptform des GUI fest.
-		 *
-		 * \param mainForm die Hauptform, die angezeigt wird, sobald das GUI aktiviert wird
-		 */
-		void Run(const std::shared_ptr<Form> &mainForm);
-		/**
-		 * Gibt eine MouseMessage an die geffneten Formen weiter.
-		 *
-		 * \param mouse
-		 * \return true, falls die Nachricht verarbeitet wurde
-		 */
-		bool ProcessMouseMessage(const MouseMessage &mouse);
-		/**
-		 * Gibt eine KeyboardMessage an die geffneten Formen weiter.
-		 *
-		 * \param keyboard
-		 * \return true, falls die Nachricht verarbeitet wurde
-		 */
-		bool ProcessKeyboardMessage(const KeyboardMessage &keyboard);
-		
-		/**
-		 * Zeichnet die geffneten Formen.
-		 */
-		void Render();
-
-		/**
-		 * Registriert einen neuen Hotkey.
-		 *
-		 * \param hotkey
-		 */
-		void RegisterHotkey(const Hotkey &hotkey);
-		/**
-		 * Entfernt einen Hotkey.
-		 *
-		 * \param hotkey
-		 */
-		void UnregisterHotkey(const Hotkey &hotkey);
-		
-		/**
-		 * Ruft die aktuelle Instanz der Application ab.
-		 *
-		 * \return instance
-		 */
-		static Application& Instance();
-		static Application* InstancePtr();
-
-		static bool HasBeenInitialized();
-
-		class GuiRenderSurface : public Drawing::RenderSurface
-		{
-		public:
-			GuiRenderSurface(Drawing::RenderTarget &target);
-
-			void Invalidate();
-
-			virtual void Draw() override;
-
-		private:
-			friend void Application::Render();
-
-			bool needsRedraw_;
-		};
-
-	private:
-		static Application *instance;
-		Application(std::unique_ptr<Drawing::Renderer> &&renderer);
-
-		//copying prohibited
-		Application(const Application&);
-		void operator=(const Application&);
-
-		void InjectTime();
-
-		std::unique_ptr<Drawing::Renderer> renderer_;
-		GuiRenderSurface guiSurface_;
-		Drawing::FontPtr defaultFont_;
-		
-		Drawing::Style _currentStyle;
-	
-		FormManager formManager_;
-		
-		Misc::DateTime now_;
-
-		struct
-		{
-			Drawing::PointF Location;
-			std::shared_ptr<Cursor> Cursor;
-			bool Enabled;
-		} mouse_;
-
-		std::vector<Hotkey> hotkeys_;
-
-		Control *FocusedControl;
-		Control *CaptureControl;
-		Control *MouseEnteredControl;
-
-		bool isEnabled_;
-	};
-}
-
-#endif
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_APPLICATION_HPP
+#define OSHGUI_APPLICATION_HPP
+
+#include <memory>
+#include <vector>
+#include "Drawing/Renderer.hpp"
+#include "Drawing/RenderContext.hpp"
+#include "Drawing/Font.hpp"
+#include "Drawing/Style.hpp"
+#include "Drawing/Theme.hpp"
+#include "Misc/DateTime.hpp"
+#include "Misc/Clock.hpp"
+#include "Misc/MpscQueue.hpp"
+#include "Event/Delegate.hpp"
+#include "Cursor/Cursor.hpp"
+#include "Event/MouseMessage.hpp"
+#include "Event/KeyboardMessage.hpp"
+#include "Exports.hpp"
+#include "FormManager.hpp"
+#include "TimerScheduler.hpp"
+#include "Animation/Animator.hpp"
+#include "Event/Hotkey.hpp"
+
+namespace OSHGui
+{
+	class Control;
+	class Form;
+	namespace Input
+	{
+		class InputRecorder;
+	}
+	
+	/**
+	 * Stellt Methoden und Eigenschaften für die Verwaltung einer
+	 * Anwendung zur Verfügung, z.B. Methoden zum Starten und Beenden einer
+	 * Anwendung sowie für das Abrufen von Informationen zu einer Anwendung.
+	 */
+	class OSHGUI_EXPORT Application
+	{
+		friend Control;
+		friend Form;
+
+	public:
+		class GuiRenderSurface;
+
+		/**
+		 * Zeit zwischen dem Entstehen einer Eingabe und dem Ende des Frames, der sie zeichnet.
+		 */
+		struct InputLatency
+		{
+			Misc::Clock::Duration Last;
+			Misc::Clock::Duration Max;
+			Misc::Clock::Duration Total;
+			unsigned long long Samples;
+
+			InputLatency();
+
+			/**
+			 * Ruft die durchschnittliche Latenz ab.
+			 *
+			 * \return average
+			 */
+			Misc::Clock::Duration GetAverage() const;
+		};
+
+		/**
+		 * Initialisiert die Application-Klasse.
+		 *
+		 * \param renderer Instanz des verwendeten Renderers
+		 */
+		static void Initialize(std::unique_ptr<Drawing::Renderer> &&renderer);
+		
+		/**
+		 * Ruft ab, ob das GUI aktiviert ist.
+		 *
+		 * return isEnabled
+		 */
+		bool IsEnabled() const;
+		/**
+		 * Ruft die aktuelle Uhrzeit ab.
+		 *
+		 * \return DateTime::Now
+		 */
+		const Misc::DateTime& GetNow() const;
+		/**
+		 * Ruft den monotonen Zeitpunkt des aktuellen Frames ab.
+		 *
+		 * \return time
+		 */
+		const Misc::Clock::TimePoint& GetTime() const;
+		/**
+		 * Legt die Zeitquelle für Timer und InjectTime fest. Mit nullptr wird
+		 * wieder std::chrono::steady_clock verwendet.
+		 *
+		 * \param clock
+		 */
+		void SetClock(const std::shared_ptr<Misc::Clock> &clock);
+		/**
+		 * Ruft die verwendete Zeitquelle ab.
+		 *
+		 * \return clock
+		 */
+		Misc::Clock& GetClock() const;
+		/**
+		 * Ruft die verwendete Zeitquelle ab, um sie später mit SetClock wiederherzustellen.
+		 *
+		 * \return clock
+		 */
+		const std::shared_ptr<Misc::Clock>& GetSharedClock() const;
+		/**
+		 * Ruft den Animator ab, der die laufenden Animationen mit jedem Frame fortschreibt.
+		 *
+		 * \return animator
+		 */
+		Animator& GetAnimator();
+
+		/**
+		 * Ruft den verwendeten Renderer ab.
+		 *
+		 * \return renderer
+		 */
+		Drawing::Renderer& GetRenderer() const;
+		/**
+		 * Ruft das RenderSurface der Gui ab.
+		 *
+		 * \return GuiRenderSurface
+		 */
+		GuiRenderSurface& GetRenderSurface();
+		/**
+		 * Legt die Display-Größe fest.
+		 *
+		 * @param size
+		 */
+		void DisplaySizeChanged(const Drawing::SizeF &size);
+		
+		/**
+		 * Legt die Standardschrift für das Gui fest.
+		 *
+		 * \param font Standardschrift
+		 */
+		void SetDefaultFont(const Drawing::FontPtr &font);
+		/**
+		 * Ruft die Standardschrift für das Gui ab.
+		 *
+		 * \return Standardschrift
+		 */
+		Drawing::FontPtr& GetDefaultFont();
+		
+		/**
+		 * Ruft die aktuelle Mausposition ab.
+		 *
+		 * \return cursorLocation
+		 */
+		const Drawing::PointF& GetCursorLocation() const;
+		/**
+		 * Ruft den Cursor ab.
+		 *
+		 * \return cursor
+		 */
+		const std::shared_ptr<Cursor>& GetCursor() const;
+		/**
+		 * Legt den Cursor fest.
+		 *
+		 * \param cursor
+		 */
+		void SetCursor(const std::shared_ptr<Cursor> &cursor);
+		/**
+		 * Legt fest, ob der Cursor gezeichnet werden soll.
+		 *
+		 * \param enabled
+		 */
+		void SetCursorEnabled(bool enabled);
+		/**
+		 * Legt den InputRecorder fest, der alle eingehenden Nachrichten und Frames aufzeichnet.
+		 *
+		 * \param recorder nullptr beendet die Aufzeichnung
+		 */
+		void SetInputRecorder(const std::shared_ptr<Input::InputRecorder> &recorder);
+		/**
+		 * Ruft den InputRecorder ab.
+		 *
+		 * \return recorder
+		 */
+		const std::shared_ptr<Input::InputRecorder>& GetInputRecorder() const;
+		
+		/**
+		 * Legt den Style für das Gui fest.
+		 *
+		 * \param style
+		 */
+		void SetStyle(const Drawing::Style &style);
+		/**
+		 * Ruft den Style für das Gui ab.
+		 *
+		 * \return style
+		 */
+		const Drawing::Style& GetStyle() const;
+		/**
+		 * Legt den Style für das Gui fest und übernimmt dabei nur die Eigenschaften,
+		 * die sich vom aktuellen Style unterscheiden.
+		 *
+		 * \param style
+		 */
+		void UpdateStyle(const Drawing::Style &style);
+		/**
+		 * Lädt ein Theme (JSON oder Binär) und übernimmt es als Style. Wird die Datei
+		 * beobachtet, werden Änderungen beim Zeichnen automatisch übernommen.
+		 *
+		 * \param file
+		 * \param watch legt fest, ob die Datei auf Änderungen beobachtet wird
+		 * \return false, falls das Theme nicht geladen werden konnte
+		 */
+		bool LoadTheme(const Misc::AnsiString &file, bool watch = false);
+	
+		/**
+		 * Beginnt eine Aktualisierung. Bis zum passenden EndUpdate werden Invalidate-Aufrufe
+		 * nur vorgemerkt und gemeinsam verarbeitet. Aufrufe dürfen verschachtelt werden.
+		 */
+		void BeginUpdate();
+		/**
+		 * Beendet eine Aktualisierung. Die äußerste Aktualisierung verarbeitet alle
+		 * vorgemerkten Invalidate-Aufrufe.
+		 */
+		void EndUpdate();
+		/**
+		 * Ruft ab, ob gerade eine Aktualisierung läuft.
+		 *
+		 * \return ja / nein
+		 */
+		bool IsUpdating() const;
+	
+		/**
+		 * Aktiviert das GUI.
+		 */
+		void Enable();
+		/**
+		 * Deaktiviert das GUI.
+		 */
+		void Disable();
+		/**
+		 * Wechselt zwischen Enabled und Disabled.
+		 */
+		void Toggle();
+
+		/**
+		 * Legt die Hauptform des GUI fest.
+		 *
+		 * \param mainForm die Hauptform, die angezeigt wird, sobald das GUI aktiviert wird
+		 */
+		void Run(const std::shared_ptr<Form> &mainForm);
+		/**
+		 * Gibt eine MouseMessage an die geöffneten Formen weiter.
+		 *
+		 * \param mouse
+		 * \return true, falls die Nachricht verarbeitet wurde
+		 */
+		bool ProcessMouseMessage(const MouseMessage &mouse);
+		/**
+		 * Gibt eine KeyboardMessage an die geöffneten Formen weiter.
+		 *
+		 * \param keyboard
+		 * \return true, falls die Nachricht verarbeitet wurde
+		 */
+		bool ProcessKeyboardMessage(const KeyboardMessage &keyboard);
+		
+		/**
+		 * Ruft die Latenz zwischen Eingabe und Zeichnen ab. Gemessen wird je Frame die
+		 * älteste verarbeitete Nachricht mit Zeitstempel.
+		 *
+		 * \return latency
+		 */
+		const InputLatency& GetInputLatency() const;
+		/**
+		 * Setzt die Latenzstatistik zurück.
+		 */
+		void ResetInputLatency();
+
+		/**
+		 * Stellt eine Funktion in die Warteschlange, die beim nächsten Render im GUI-Thread
+		 * ausgeführt wird. Darf von beliebigen Threads aufgerufen werden und blockiert nie.
+		 *
+		 * \param function
+		 * \return false, falls die Warteschlange voll ist
+		 */
+		bool Dispatch(Delegate<void()> function);
+
+		/**
+		 * Zeichnet die geöffneten Formen.
+		 */
+		void Render();
+
+		/**
+		 * Registriert einen neuen Hotkey.
+		 *
+		 * \param hotkey
+		 */
+		void RegisterHotkey(const Hotkey &hotkey);
+		/**
+		 * Entfernt einen Hotkey.
+		 *
+		 * \param hotkey
+		 */
+		void UnregisterHotkey(const Hotkey &hotkey);
+		
+		/**
+		 * Ruft die aktuelle Instanz der Application ab.
+		 *
+		 * \return instance
+		 */
+		static Application& Instance();
+		static Application* InstancePtr();
+
+		static bool HasBeenInitialized();
+
+		/**
+		 * Ruft BeginUpdate im Konstruktor und EndUpdate im Destruktor auf.
+		 */
+		class UpdateScope
+		{
+		public:
+			UpdateScope();
+			~UpdateScope();
+
+		private:
+			//copying prohibited
+			UpdateScope(const UpdateScope&);
+			void operator=(const UpdateScope&);
+		};
+
+		class GuiRenderSurface : public Drawing::RenderSurface
+		{
+		public:
+			GuiRenderSurface(Drawing::RenderTarget &target);
+
+			void Invalidate();
+
+			virtual void Draw() override;
+
+		private:
+			friend void Application::Render();
+
+			bool needsRedraw_;
+		};
+
+	private:
+		static Application *instance;
+		static const std::size_t DispatchQueueCapacity = 1024;
+		Application(std::unique_ptr<Drawing::Renderer> &&renderer);
+
+		//copying prohibited
+		Application(const Application&);
+		void operator=(const Application&);
+
+		void InjectTime();
+		void FlushInvalidations();
+		/**
+		 * Berechnet die absoluten Positionen der verschobenen Teilbäume aller Forms.
+		 */
+		void UpdatePendingLocations();
+		void ProcessDispatchQueue();
+		void RecordInput(const Misc::Clock::TimePoint &timestamp);
+		void CheckThemeFile();
+		bool ProcessMouseMessage(Form &form, const MouseMessage &message);
+
+		std::unique_ptr<Drawing::Renderer> renderer_;
+		GuiRenderSurface guiSurface_;
+		Drawing::FontPtr defaultFont_;
+		
+		Drawing::Style _currentStyle;
+		Drawing::ThemeWatcher themeWatcher_;
+		Misc::Clock::TimePoint nextThemeCheck_;
+	
+		FormManager formManager_;
+		TimerScheduler timerScheduler_;
+		Animator animator_;
+		Misc::MpscQueue<Delegate<void()>> dispatchQueue_;
+		
+		Misc::DateTime now_;
+		std::shared_ptr<Misc::Clock> clock_;
+		Misc::Clock::TimePoint time_;
+
+		struct
+		{
+			Drawing::PointF Location;
+			std::shared_ptr<Cursor> Cursor;
+			bool Enabled;
+		} mouse_;
+
+		std::vector<Hotkey> hotkeys_;
+		std::vector<Control*> hitTestControls_;
+
+		std::shared_ptr<Input::InputRecorder> inputRecorder_;
+		InputLatency inputLatency_;
+		Misc::Clock::TimePoint oldestPendingInput_;
+		bool hasPendingInput_;
+
+		Control *FocusedControl;
+		Control *CaptureControl;
+		Control *MouseEnteredControl;
+
+		bool isEnabled_;
+
+		int updateDepth_;
+		bool hasPendingInvalidations_;
+		bool hasPendingLocations_;
+	};
+}
+
+#endif
@@ -1,1015 +1,1553 @@
-/*
- * OldSchoolHack GUI
- *
- * Copyright (c) 2013 KN4CK3R http://www.oldschoolhack.de
- *
- * See license in OSHGui.hpp
- */
-
-#include "Control.hpp"
-#include "../Misc/Exceptions.hpp"
-#include "../Drawing/FontManager.hpp"
-#include "../Drawing/Vector.hpp"
-#include "../Misc/ReverseIterator.hpp"
-#include "../Misc/Intersection.hpp"
-#include <algorithm>
-
-namespace OSHGui
-{
-	//---------------------------------------------------------------------------
-	//Constructor
-	//---------------------------------------------------------------------------
-	Control::Control()
-		: type_(ControlType::None),
-		  parent_(nullptr),
-		  location_(6, 6),
-		  size_(0, 0),
-		  anchor_(AnchorStyles::Top | AnchorStyles::Left),
-		  isEnabled_(true),
-		  isVisible_(true),
-		  isFocused_(false),
-		  isClicked_(false),
-		  isInside_(false),
-		  isFocusable_(true),
-		  hasCaptured_(false),
-		  autoSize_(false),
-		  canRaiseEvents_(true),
-		  needsRedraw_(true),
-		  cursor_(nullptr),
-		  mouseOverFocusColor_(Drawing::Color::FromARGB(0, 20, 20, 20)),
-		  geometry_(Application::Instance().GetRenderer().CreateGeometryBuffer())
-	{
-		
-	}
-	//---------------------------------------------------------------------------
-	Control::~Control()
-	{
-		if (isInside_)
-		{
-			Application::Instance().MouseEnteredControl = nullptr;
-		}
-		if (isFocused_)
-		{
-			Application::Instance().FocusedControl = nullptr;
-		}
-
-		for (auto &control : internalControls_)
-		{
-			delete control;
-		}
-	}
-	//---------------------------------------------------------------------------
-	//Getter/Setter
-	//---------------------------------------------------------------------------
-	ControlType Control::GetType() const
-	{
-		return type_;
-	}
-	//---------------------------------------------------------------------------
-	bool Control::IsContainer() const
-	{
-		return false;
-	}
-	//---------------------------------------------------------------------------
-	bool Control::GetIsFocused() const
-	{
-		return isFocused_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetEnabled(bool isEnabled)
-	{
-		isEnabled_ = isEnabled;
-		if (isEnabled == false && isFocused_)
-		{
-			OnLostFocus(nullptr);
-		}
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	bool Control::GetEnabled() const
-	{
-		return isEnabled_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetVisible(bool isVisible)
-	{
-		isVisible_ = isVisible;
-		if (isVisible == false && isFocused_)
-		{
-			OnLostFocus(nullptr);
-		}
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	bool Control::GetVisible() const
-	{
-		return isVisible_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetAutoSize(bool autoSize)
-	{
-		autoSize_ = autoSize;
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	bool Control::GetAutoSize() const
-	{
-		return autoSize_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetBounds(int x, int y, int w, int h)
-	{
-		SetBounds(Drawing::PointF(x, y), Drawing::SizeF(w, h));
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetBounds(const Drawing::PointI &location, const Drawing::SizeI &size)
-	{
-		SetLocation(location);
-		SetSize(size);
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetBounds(const Drawing::RectangleI &bounds)
-	{
-		SetBounds(bounds.GetLocation(), bounds.GetSize());
-	}
-	//---------------------------------------------------------------------------
-	Drawing::RectangleI Control::GetBounds() const
-	{
-		return Drawing::RectangleI(location_, size_);
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetLocation(const Drawing::PointI &location)
-	{
-		location_ = location;
-
-		OnLocationChanged();
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetLocation(int x, int y)
-	{
-		SetLocation(Drawing::PointI(x, y));
-	}
-	//---------------------------------------------------------------------------
-	const Drawing::PointI& Control::GetLocation() const
-	{
-		return location_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetSize(const Drawing::SizeI &size)
-	{
-		#ifndef OSHGUI_DONTUSEEXCEPTIONS
-		if (size.Width < 0)
-		{
-			throw Misc::ArgumentOutOfRangeException("width");
-		}
-		if (size.Height < 0)
-		{
-			throw Misc::ArgumentOutOfRangeException("height");
-		}
-		#endif
-
-		size_ = size;
-		
-		OnSizeChanged();
-
-		Invalidate();
-
-		const auto offset = size_ - GetSize();
-		for (auto &control : controls_)
-		{
-			const auto anchor = control->GetAnchor();
-
-			if (anchor != (AnchorStyles::Top | AnchorStyles::Left))
-			{
-				if (anchor == (AnchorStyles::Top | AnchorStyles::Left | AnchorStyles::Bottom | AnchorStyles::Right))
-				{
-					control->SetSize(control->GetSize() + offset);
-				}
-				else if (anchor == (AnchorStyles::Top | AnchorStyles::Left | AnchorStyles::Right) || anchor == (AnchorStyles::Bottom | AnchorStyles::Left | AnchorStyles::Right))
-				{
-					control->SetLocation(control->GetLocation() + Drawing::PointF(0, offset.Height));
-					control->SetSize(control->GetSize() + Drawing::SizeF(offset.Width, 0));
-				}
-				else if (anchor == (AnchorStyles::Top | AnchorStyles::Right) || anchor == (AnchorStyles::Bottom | AnchorStyles::Right))
-				{
-					control->SetLocation(control->GetLocation() + Drawing::PointF(offset.Width, offset.Height));
-				}
-			}
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetSize(int width, int height)
-	{
-		SetSize(Drawing::SizeI(width, height));
-	}
-	//---------------------------------------------------------------------------
-	const Drawing::SizeI& Control::GetSize() const
-	{
-		return size_;
-	}
-	//---------------------------------------------------------------------------
-	int Control::GetLeft() const
-	{
-		return location_.Left;
-	}
-	//---------------------------------------------------------------------------
-	int Control::GetTop() const
-	{
-		return location_.Top;
-	}
-	//---------------------------------------------------------------------------
-	int Control::GetRight() const
-	{
-		return location_.Left + size_.Width;
-	}
-	//---------------------------------------------------------------------------
-	int Control::GetBottom() const
-	{
-		return location_.Top + size_.Height;
-	}
-	//---------------------------------------------------------------------------
-	int Control::GetWidth() const
-	{
-		return size_.Width;
-	}
-	//---------------------------------------------------------------------------
-	int Control::GetHeight() const
-	{
-		return size_.Height;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetAnchor(AnchorStyles anchor)
-	{
-		anchor_ = anchor;
-	}
-	//---------------------------------------------------------------------------
-	AnchorStyles Control::GetAnchor() const
-	{
-		return anchor_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetTag(const Misc::Any &tag)
-	{
-		tag_ = tag;
-	}
-	//---------------------------------------------------------------------------
-	const Misc::Any& Control::GetTag() const
-	{
-		return tag_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetName(const Misc::AnsiString &name)
-	{
-		name_ = name;
-	}
-	//---------------------------------------------------------------------------
-	const Misc::AnsiString& Control::GetName() const
-	{
-		return name_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetForeColor(const Drawing::Color &color)
-	{
-		foreColor_ = color;
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	const Drawing::Color& Control::GetForeColor() const
-	{
-		return foreColor_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetBackColor(const Drawing::Color &color)
-	{
-		backColor_ = color;
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	const Drawing::Color& Control::GetBackColor() const
-	{
-		return backColor_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetMouseOverFocusColor(const Drawing::Color &color)
-	{
-		mouseOverFocusColor_ = color;
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	const Drawing::Color& Control::GetMouseOverFocusColor() const
-	{
-		return mouseOverFocusColor_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetFont(const Drawing::FontPtr &font)
-	{
-		#ifndef OSHGUI_DONTUSEEXCEPTIONS
-		if (font == nullptr)
-		{
-			throw Misc::ArgumentNullException("font");
-		}
-		#endif
-		
-		font_ = font;
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	const Drawing::FontPtr& Control::GetFont() const
-	{
-		return font_ ? font_ : parent_ ? parent_->GetFont() : Application::Instance().GetDefaultFont();
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetCursor(const CursorPtr &cursor)
-	{
-		cursor_ = std::move(cursor);
-	}
-	//---------------------------------------------------------------------------
-	const CursorPtr& Control::GetCursor() const
-	{
-		return cursor_ ? cursor_ : GetParent() ? GetParent()->GetCursor() : Cursors::Get(Cursors::Default);
-	}
-	//---------------------------------------------------------------------------
-	LocationChangedEvent& Control::GetLocationChangedEvent()
-	{
-		return locationChangedEvent_;
-	}
-	//---------------------------------------------------------------------------
-	SizeChangedEvent& Control::GetSizeChangedEvent()
-	{
-		return sizeChangedEvent_;
-	}
-	//---------------------------------------------------------------------------
-	ClickEvent& Control::GetClickEvent()
-	{
-		return clickEvent_;
-	}
-	//---------------------------------------------------------------------------
-	MouseClickEvent& Control::GetMouseClickEvent()
-	{
-		return mouseClickEvent_;
-	}
-	//---------------------------------------------------------------------------
-	MouseDownEvent& Control::GetMouseDownEvent()
-	{
-		return mouseDownEvent_;
-	}
-	//---------------------------------------------------------------------------
-	MouseUpEvent& Control::GetMouseUpEvent()
-	{
-		return mouseUpEvent_;
-	}
-	//---------------------------------------------------------------------------
-	MouseMoveEvent& Control::GetMouseMoveEvent()
-	{
-		return mouseMoveEvent_;
-	}
-	//---------------------------------------------------------------------------
-	MouseScrollEvent& Control::GetMouseScrollEvent()
-	{
-		return mouseScrollEvent_;
-	}
-	//---------------------------------------------------------------------------
-	MouseEnterEvent& Control::GetMouseEnterEvent()
-	{
-		return mouseEnterEvent_;
-	}
-	//---------------------------------------------------------------------------
-	MouseLeaveEvent& Control::GetMouseLeaveEvent()
-	{
-		return mouseLeaveEvent_;
-	}
-	//---------------------------------------------------------------------------
-	KeyDownEvent& Control::GetKeyDownEvent()
-	{
-		return keyDownEvent_;
-	}
-	//---------------------------------------------------------------------------
-	KeyPressEvent& Control::GetKeyPressEvent()
-	{
-		return keyPressEvent_;
-	}
-	//---------------------------------------------------------------------------
-	KeyUpEvent& Control::GetKeyUpEvent()
-	{
-		return keyUpEvent_;
-	}
-	//---------------------------------------------------------------------------
-	FocusGotEvent& Control::GetFocusGotEvent()
-	{
-		return focusGotEvent_;
-	}
-	//---------------------------------------------------------------------------
-	FocusLostEvent& Control::GetFocusLostEvent()
-	{
-		return focusLostEvent_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::SetParent(Control *parent)
-	{
-		#ifndef OSHGUI_DONTUSEEXCEPTIONS
-		if (parent == nullptr)
-		{
-			throw Misc::ArgumentNullException("parent");
-		}
-		#endif
-
-		parent_ = parent;
-
-		OnLocationChanged();
-	}
-	//---------------------------------------------------------------------------
-	Control* Control::GetParent() const
-	{
-		return parent_;
-	}
-	//---------------------------------------------------------------------------
-	const std::deque<Control*>& Control::GetControls() const
-	{
-		return controls_;
-	}
-	//---------------------------------------------------------------------------
-	Control::PostOrderIterator Control::GetPostOrderEnumerator()
-	{
-		return PostOrderIterator(this);
-	}
-	//---------------------------------------------------------------------------
-	void Control::GetRenderContext(Drawing::RenderContext &context) const
-	{
-		if (surface_)
-		{
-			context.Surface = surface_.get();
-			context.Owner = this;
-			context.Offset = GetLocation();
-			context.QueueType = Drawing::RenderQueueType::Base;
-		}
-		else if (GetParent())
-		{
-			GetParent()->GetRenderContext(context);
-		}
-		else
-		{
-			context.Surface = &Application::Instance().GetRenderSurface();
-			context.Owner = nullptr;
-			context.Offset = Drawing::PointF(0.0f, 0.0f);
-			context.QueueType = Drawing::RenderQueueType::Base;
-		}
-	}
-	//---------------------------------------------------------------------------
-	//Runtime-Functions
-	//---------------------------------------------------------------------------
-	void Control::Focus()
-	{
-		if (isFocusable_ && !isFocused_)
-		{
-			OnGotFocus(this);
-		}
-	}
-	//---------------------------------------------------------------------------
-	bool Control::Intersect(const Drawing::PointI &point) const
-	{
-		return Intersection::TestRectangle(absoluteLocation_, size_, point);
-	}
-	//---------------------------------------------------------------------------
-	Drawing::PointI Control::PointToClient(const Drawing::PointI &point) const
-	{
-		return point - absoluteLocation_;
-	}
-	//---------------------------------------------------------------------------
-	Drawing::PointI Control::PointToScreen(const Drawing::PointI &point) const
-	{
-		#ifndef OSHGUI_DONTUSEEXCEPTIONS
-		if (!parent_)
-		{
-			throw Misc::ArgumentNullException("parent");
-		}
-		#endif
-		
-		if (parent_ != this)
-		{
-			return parent_->PointToScreen(point + location_);
-		}
-
-		return point + location_;
-	}
-	//---------------------------------------------------------------------------
-	void Control::CalculateAbsoluteLocation()
-	{
-		if (parent_ != nullptr)
-		{
-			absoluteLocation_ = parent_->absoluteLocation_ + location_;
-		}
-		else
-		{
-			absoluteLocation_ = location_;
-		}
-
-		geometry_->SetTranslation(Drawing::Vector(absoluteLocation_.X, absoluteLocation_.Y, 0.0f));
-		//TODO: set clipping here
-
-		for (auto &control : internalControls_)
-		{
-			control->CalculateAbsoluteLocation();
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Control::AddControl(Control *control)
-	{
-		#ifndef OSHGUI_DONTUSEEXCEPTIONS
-		if (control == nullptr)
-		{
-			throw Misc::ArgumentNullException("control");
-		}
-		#endif
-
-		if (control->GetType() == ControlType::Form)
-		{
-			return;
-		}
-
-		AddSubControl(control);
-
-		controls_.push_front(control);
-	}
-	//---------------------------------------------------------------------------
-	void Control::RemoveControl(Control *control)
-	{
-		if (control != nullptr)
-		{
-			controls_.erase(std::remove(std::begin(controls_), std::end(controls_), control), std::end(controls_));
-			internalControls_.erase(std::remove(std::begin(internalControls_), std::end(internalControls_), control), std::end(internalControls_));
-
-			Invalidate();
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Control::AddSubControl(Control *subcontrol)
-	{
-		#ifndef OSHGUI_DONTUSEEXCEPTIONS
-		if (subcontrol == nullptr)
-		{
-			throw Misc::ArgumentNullException("subcontrol");
-		}
-		#endif
-
-		if (subcontrol->GetType() == ControlType::Form)
-		{
-			return;
-		}
-
-		for (auto &control : internalControls_)
-		{
-			if (subcontrol == control || (!subcontrol->GetName().empty() && subcontrol->GetName() == control->GetName()))
-			{
-				return;
-			}
-		}
-
-		subcontrol->SetParent(this);
-
-		internalControls_.push_front(subcontrol);
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	Control* Control::GetChildAtPoint(const Drawing::PointI &point) const
-	{
-		for (auto &control : make_reverse_range(controls_))
-		{
-			if (control->GetEnabled() && control->GetVisible() && control->Intersect(point))
-			{
-				return control;
-			}
-		}
-
-		return nullptr;
-	}
-	//---------------------------------------------------------------------------
-	Control* Control::GetChildByName(const Misc::AnsiString &name) const
-	{
-		for (auto &control : controls_)
-		{
-			if (control->GetName() == name)
-			{
-				return control;
-			}
-		}
-
-		return nullptr;
-	}
-	//---------------------------------------------------------------------------
-	void Control::InjectTime(const Misc::DateTime &time)
-	{
-
-	}
-	//---------------------------------------------------------------------------
-	void Control::Invalidate()
-	{
-		needsRedraw_ = true;
-
-		Application::Instance().GetRenderSurface().Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	void Control::Render()
-	{
-		if (!isVisible_)
-		{
-			return;
-		}
-
-		using namespace Drawing;
-
-		RenderContext ctx;
-		GetRenderContext(ctx);
-
-		// clear geometry from surface if it's ours
-		if (ctx.Owner == this)
-		{
-			ctx.Surface->Reset();
-		}
-
-		// redraw if no surface set, or if surface is invalidated
-		if (!surface_)// || surface->isInvalidated())
-		{
-			DrawSelf(ctx);
-
-			Control *focusedControl = nullptr;
-			for (auto &control : make_reverse_range(controls_))
-			{
-				if (control->GetIsFocused())
-				{
-					focusedControl = control;
-				}
-				else
-				{
-					control->Render();
-				}
-			}
-			if (focusedControl != nullptr)
-			{
-				focusedControl->Render();
-			}
-		}
-
-		if (ctx.Owner == this)
-		{
-			ctx.Surface->Draw();
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Control::DrawSelf(Drawing::RenderContext &context)
-	{
-		BufferGeometry(context);
-		QueueGeometry(context);
-	}
-	//---------------------------------------------------------------------------
-	void Control::BufferGeometry(Drawing::RenderContext &context)
-	{
-		if (needsRedraw_)
-		{
-			geometry_->Reset();
-
-			PopulateGeometry();
-
-			needsRedraw_ = false;
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Control::QueueGeometry(Drawing::RenderContext &context)
-	{
-		context.Surface->AddGeometry(context.QueueType, geometry_);
-	}
-	//---------------------------------------------------------------------------
-	void Control::PopulateGeometry()
-	{
-
-	}
-	//---------------------------------------------------------------------------
-	void Control::ApplyStyle(const Drawing::Style &style)
-	{
-		auto &controlStyle = style.GetControlStyle(type_);
-		SetForeColor(controlStyle.ForeColor);
-		SetBackColor(controlStyle.BackColor);
-
-		for (auto &control : GetControls())
-		{
-			control->ApplyStyle(style);
-		}
-	}
-	//---------------------------------------------------------------------------
-	//Event-Handling
-	//---------------------------------------------------------------------------
-	void Control::OnLocationChanged()
-	{
-		CalculateAbsoluteLocation();
-
-		Invalidate();
-	
-		locationChangedEvent_.Invoke(this);
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnSizeChanged()
-	{
-		sizeChangedEvent_.Invoke(this);
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnMouseDown(const MouseMessage &mouse)
-	{
-		isClicked_ = true;
-
-		Invalidate();
-
-		MouseEventArgs args(mouse);
-		args.Location -= absoluteLocation_;
-		mouseDownEvent_.Invoke(this, args);
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnMouseClick(const MouseMessage &mouse)
-	{
-		MouseEventArgs args(mouse);
-		args.Location -= absoluteLocation_;
-		mouseClickEvent_.Invoke(this, args);
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnMouseUp(const MouseMessage &mouse)
-	{
-		isClicked_ = false;
-
-		Invalidate();
-
-		MouseEventArgs args(mouse);
-		args.Location -= absoluteLocation_;
-		mouseUpEvent_.Invoke(this, args);
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnMouseMove(const MouseMessage &mouse)
-	{
-		MouseEventArgs args(mouse);
-		args.Location -= absoluteLocation_;
-		mouseMoveEvent_.Invoke(this, args);
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnMouseScroll(const MouseMessage &mouse)
-	{
-		MouseEventArgs args(mouse);
-		args.Location -= absoluteLocation_;
-		mouseScrollEvent_.Invoke(this, args);
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnMouseEnter(const MouseMessage &mouse)
-	{
-		isInside_ = true;
-
-		auto &app = Application::Instance();
-
-		if (app.MouseEnteredControl != nullptr && app.MouseEnteredControl->isInside_)
-		{
-			app.MouseEnteredControl->OnMouseLeave(mouse);
-		}
-		app.MouseEnteredControl = this;
-
-		mouseEnterEvent_.Invoke(this);
-
-		Invalidate();
-
-		app.SetCursor(GetCursor());
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnMouseLeave(const MouseMessage &mouse)
-	{
-		isInside_ = false;
-
-		Application::Instance().MouseEnteredControl = nullptr;
-
-		mouseLeaveEvent_.Invoke(this);
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnGotMouseCapture()
-	{
-		auto &app = Application::Instance();
-		if (app.CaptureControl != nullptr)
-		{
-			app.CaptureControl->OnLostMouseCapture();
-		}
-		app.CaptureControl = this;
-		hasCaptured_ = true;
-
-		isClicked_ = false;
-
-		mouseCaptureChangedEvent_.Invoke(this);
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnLostMouseCapture()
-	{
-		hasCaptured_ = false;
-
-		Application::Instance().CaptureControl = nullptr;
-
-		mouseCaptureChangedEvent_.Invoke(this);
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnGotFocus(Control *newFocusedControl)
-	{
-		auto &app = Application::Instance();
-		if (newFocusedControl != app.FocusedControl)
-		{
-			if (app.FocusedControl != nullptr)
-			{
-				app.FocusedControl->OnLostFocus(newFocusedControl);
-			}
-
-			app.FocusedControl = newFocusedControl;
-			isFocused_ = true;
-
-			focusGotEvent_.Invoke(this);
-
-			Invalidate();
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Control::OnLostFocus(Control *newFocusedControl)
-	{
-		isFocused_ = isClicked_ = false;
-		
-		Application::Instance().FocusedControl = nullptr;
-
-		focusLostEvent_.Invoke(this, newFocusedControl);
-
-		Invalidate();
-	}
-	//---------------------------------------------------------------------------
-	bool Control::OnKeyDown(const KeyboardMessage &keyboard)
-	{
-		KeyEventArgs args(keyboard);
-		keyDownEvent_.Invoke(this, args);
-
-		return args.Handled;
-	}
-	//---------------------------------------------------------------------------
-	bool Control::OnKeyPress(const KeyboardMessage &keyboard)
-	{
-		KeyPressEventArgs args(keyboard);
-		keyPressEvent_.Invoke(this, args);
-
-		return args.Handled;
-	}
-	//---------------------------------------------------------------------------
-	bool Control::OnKeyUp(const KeyboardMessage &keyboard)
-	{
-		KeyEventArgs args(keyboard);
-		keyUpEvent_.Invoke(this, args);
-
-		return args.Handled;
-	}
-	//---------------------------------------------------------------------------
-	bool Control::ProcessMouseMessage(const MouseMessage &mouse)
-	{
-		switch (mouse.GetState())
-		{
-			case MouseState::Down:
-				if (canRaiseEvents_ && Intersect(mouse.GetLocation()))
-				{
-					if (mouse.GetButton() == MouseButton::Left && !isClicked_ && isEnabled_)
-					{
-						OnMouseDown(mouse);
-						
-						if (isFocusable_ && !isFocused_)
-						{
-							OnGotFocus(this);
-						}
-					}
-
-					return true;
-				}
-				break;
-			case MouseState::Up:
-				if (canRaiseEvents_ && (hasCaptured_ || Intersect(mouse.GetLocation())))
-				{
-					if (isClicked_)
-					{
-						if (mouse.GetButton() == MouseButton::Left)
-						{
-							clickEvent_.Invoke(this);
-
-							OnMouseClick(mouse);
-						}
-					}
-
-					OnMouseUp(mouse);
-
-					return true;
-				}
-				break;
-			case MouseState::Move:
-				if (hasCaptured_ || Intersect(mouse.GetLocation()))
-				{
-					if (canRaiseEvents_)
-					{
-						if (!isInside_)
-						{
-							OnMouseEnter(mouse);
-						}
-
-						OnMouseMove(mouse);
-					}
-
-					return true;
-				}
-				break;
-			case MouseState::Scroll:
-				if (hasCaptured_ || isFocused_)
-				{
-					if (canRaiseEvents_)
-					{
-						if (mouse.GetDelta() != 0)
-						{
-							OnMouseScroll(mouse);
-						}
-					}
-
-					return true;
-				}
-				break;
-		}
-
-		return false;
-	}
-	//---------------------------------------------------------------------------
-	bool Control::ProcessKeyboardMessage(const KeyboardMessage &keyboard)
-	{
-		if (canRaiseEvents_)
-		{
-			switch (keyboard.GetState())
-			{
-				case KeyboardState::KeyDown:
-					return OnKeyDown(keyboard);
-				case KeyboardState::KeyUp:
-					return OnKeyUp(keyboard);
-				case KeyboardState::Character:
-					return OnKeyPress(keyboard);
-			}
-		}
-		
-		return false;
-	}
-	//---------------------------------------------------------------------------
-	//Control::PostOrderIterator
-	//---------------------------------------------------------------------------
-	Control::PostOrderIterator::PostOrderIterator(Control *start)
-	{
-		start_ = start;
-
-		if (start_->internalControls_.empty())
-		{
-			current_ = start_;
-		}
-		else
-		{
-			LoopThrough(start_);
-			current_ = controlStack_.back();
-			controlStack_.pop_back();
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Control::PostOrderIterator::LoopThrough(Control *container)
-	{
-		controlStack_.push_back(container);
-
-		for (auto &control : make_reverse_range(container->internalControls_))
-		{
-			if (control->GetVisible() && control->GetEnabled())
-			{
-				LoopThrough(control);
-			}
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Control::PostOrderIterator::operator++()
-	{
-		current_ = controlStack_.back();
-		controlStack_.pop_back();
-	}
-	//---------------------------------------------------------------------------
-	bool Control::PostOrderIterator::operator()()
-	{
-		return !controlStack_.empty();
-	}
-	//---------------------------------------------------------------------------
-	Control* Control::PostOrderIterator::operator*()
-	{
-		return current_;
-	}
-	//---------------------------------------------------------------------------
-}
+/*
+ * OldSchoolHack GUI
+ *
+ * Copyright (c) 2013 KN4CK3R http://www.oldschoolhack.de
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Control.hpp"
+#include "Form.hpp"
+#include "LayoutEngine.hpp"
+#include "../Misc/Exceptions.hpp"
+#include "../Drawing/FontManager.hpp"
+#include "../Drawing/Vector.hpp"
+#include "../Misc/ReverseIterator.hpp"
+#include "../Misc/Intersection.hpp"
+#include <algorithm>
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//static attributes
+	//---------------------------------------------------------------------------
+	const Drawing::RectangleI Control::Unclipped(-0x100000, -0x100000, 0x200000, 0x200000);
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	Control::Control()
+		: type_(ControlType::None),
+		  canRaiseEvents_(true),
+		  isEnabled_(true),
+		  isVisible_(true),
+		  isInside_(false),
+		  isClicked_(false),
+		  isFocusable_(true),
+		  isFocused_(false),
+		  hasCaptured_(false),
+		  autoSize_(false),
+		  location_(6, 6),
+		  size_(0, 0),
+		  mouseOverFocusColor_(Drawing::Color::FromARGB(0, 20, 20, 20)),
+		  cursor_(nullptr),
+		  needsRedraw_(true),
+		  clip_(Unclipped),
+		  opacity_(1.0f),
+		  renderOffset_(0, 0),
+		  renderScale_(1.0f),
+		  parent_(nullptr),
+		  anchor_(AnchorStyles::Top | AnchorStyles::Left),
+		  dock_(DockStyle::None),
+		  layoutSuspendCount_(0),
+		  isLayoutDirty_(false),
+		  isChildLayoutDirty_(false),
+		  isPerformingLayout_(false),
+		  isLocationDirty_(false),
+		  isChildLocationDirty_(false),
+		  isCulled_(false),
+		  isInternalControl_(false)
+	{
+		
+	}
+	//---------------------------------------------------------------------------
+	Control::~Control()
+	{
+		if (isInside_)
+		{
+			Application::Instance().MouseEnteredControl = nullptr;
+		}
+		if (isFocused_)
+		{
+			Application::Instance().FocusedControl = nullptr;
+		}
+		if (Application::HasBeenInitialized())
+		{
+			Application::Instance().timerScheduler_.Cancel(this);
+			Application::Instance().animator_.Cancel(this);
+		}
+
+		for (auto &control : internalControls_)
+		{
+			delete control;
+		}
+	}
+	//---------------------------------------------------------------------------
+	void* Control::operator new(std::size_t size)
+	{
+		return Misc::MemoryPool::AllocateSized(size);
+	}
+	//---------------------------------------------------------------------------
+	void Control::operator delete(void *memory, std::size_t size)
+	{
+		Misc::MemoryPool::DeallocateSized(memory, size);
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	ControlType Control::GetType() const
+	{
+		return type_;
+	}
+	//---------------------------------------------------------------------------
+	bool Control::IsContainer() const
+	{
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	bool Control::GetIsFocused() const
+	{
+		return isFocused_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetEnabled(bool isEnabled)
+	{
+		isEnabled_ = isEnabled;
+		InvalidatePostOrder();
+		if (isEnabled == false && isFocused_)
+		{
+			OnLostFocus(nullptr);
+		}
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	bool Control::GetEnabled() const
+	{
+		return isEnabled_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetVisible(bool isVisible)
+	{
+		isVisible_ = isVisible;
+		InvalidatePostOrder();
+		if (parent_ != nullptr && (dock_ != DockStyle::None || parent_->layoutEngine_))
+		{
+			parent_->InvalidateLayout();
+		}
+		if (isVisible == false && isFocused_)
+		{
+			OnLostFocus(nullptr);
+		}
+
+		UpdateHitTestEntry();
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	bool Control::GetVisible() const
+	{
+		return isVisible_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetAutoSize(bool autoSize)
+	{
+		autoSize_ = autoSize;
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	bool Control::GetAutoSize() const
+	{
+		return autoSize_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetBounds(int x, int y, int w, int h)
+	{
+		SetBounds(Drawing::PointF(x, y), Drawing::SizeF(w, h));
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetBounds(const Drawing::PointI &location, const Drawing::SizeI &size)
+	{
+		SetLocation(location);
+		SetSize(size);
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetBounds(const Drawing::RectangleI &bounds)
+	{
+		SetBounds(bounds.GetLocation(), bounds.GetSize());
+	}
+	//---------------------------------------------------------------------------
+	Drawing::RectangleI Control::GetBounds() const
+	{
+		return Drawing::RectangleI(location_, size_);
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetLocation(const Drawing::PointI &location)
+	{
+		location_ = location;
+
+		OnLocationChanged();
+
+		UpdateLayoutInfo();
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetLocation(int x, int y)
+	{
+		SetLocation(Drawing::PointI(x, y));
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::PointI& Control::GetLocation() const
+	{
+		return location_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetSize(const Drawing::SizeI &size)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (size.Width < 0)
+		{
+			throw Misc::ArgumentOutOfRangeException("width");
+		}
+		if (size.Height < 0)
+		{
+			throw Misc::ArgumentOutOfRangeException("height");
+		}
+		#endif
+
+		const auto sizeChanged = size_ != size;
+
+		size_ = size;
+
+		UpdateHitTestEntry();
+
+		if (sizeChanged && renderScale_ != 1.0f)
+		{
+			//der Mittelpunkt der Skalierung hat sich verschoben
+			UpdateRenderTransformTree();
+		}
+		
+		OnSizeChanged();
+
+		Invalidate();
+
+		if (sizeChanged)
+		{
+			//der Clipping-Bereich hängt von der Größe ab
+			RequestLocationUpdate();
+
+			UpdateLayoutInfo();
+
+			//die untergeordneten Steuerelemente werden erst im nächsten Layout-Durchlauf angepasst
+			if (!controls_.empty())
+			{
+				InvalidateLayout();
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetSize(int width, int height)
+	{
+		SetSize(Drawing::SizeI(width, height));
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::SizeI& Control::GetSize() const
+	{
+		return size_;
+	}
+	//---------------------------------------------------------------------------
+	int Control::GetLeft() const
+	{
+		return location_.Left;
+	}
+	//---------------------------------------------------------------------------
+	int Control::GetTop() const
+	{
+		return location_.Top;
+	}
+	//---------------------------------------------------------------------------
+	int Control::GetRight() const
+	{
+		return location_.Left + size_.Width;
+	}
+	//---------------------------------------------------------------------------
+	int Control::GetBottom() const
+	{
+		return location_.Top + size_.Height;
+	}
+	//---------------------------------------------------------------------------
+	int Control::GetWidth() const
+	{
+		return size_.Width;
+	}
+	//---------------------------------------------------------------------------
+	int Control::GetHeight() const
+	{
+		return size_.Height;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetAnchor(AnchorStyles anchor)
+	{
+		anchor_ = anchor;
+
+		UpdateLayoutInfo();
+	}
+	//---------------------------------------------------------------------------
+	AnchorStyles Control::GetAnchor() const
+	{
+		return anchor_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetDock(DockStyle dock)
+	{
+		if (dock_ != dock)
+		{
+			dock_ = dock;
+
+			if (parent_ != nullptr)
+			{
+				parent_->InvalidateLayout();
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	DockStyle Control::GetDock() const
+	{
+		return dock_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetLayoutEngine(const std::shared_ptr<LayoutEngine> &layoutEngine)
+	{
+		layoutEngine_ = layoutEngine;
+
+		InvalidateLayout();
+	}
+	//---------------------------------------------------------------------------
+	LayoutEngine& Control::GetLayoutEngine() const
+	{
+		return layoutEngine_ ? *layoutEngine_ : DefaultLayout::Instance();
+	}
+	//---------------------------------------------------------------------------
+	Drawing::SizeI Control::GetPreferredSize() const
+	{
+		return GetLayoutEngine().Measure(*this);
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetTag(const Misc::Any &tag)
+	{
+		tag_ = tag;
+	}
+	//---------------------------------------------------------------------------
+	const Misc::Any& Control::GetTag() const
+	{
+		return tag_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetName(const Misc::AnsiString &name)
+	{
+		name_ = name;
+	}
+	//---------------------------------------------------------------------------
+	const Misc::AnsiString& Control::GetName() const
+	{
+		return name_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetForeColor(const Drawing::Color &color)
+	{
+		foreColor_ = color;
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::Color& Control::GetForeColor() const
+	{
+		return foreColor_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetBackColor(const Drawing::Color &color)
+	{
+		backColor_ = color;
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::Color& Control::GetBackColor() const
+	{
+		return backColor_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetMouseOverFocusColor(const Drawing::Color &color)
+	{
+		mouseOverFocusColor_ = color;
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::Color& Control::GetMouseOverFocusColor() const
+	{
+		return mouseOverFocusColor_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetOpacity(float opacity)
+	{
+		opacity_ = std::max(0.0f, std::min(1.0f, opacity));
+
+		UpdateRenderTransformTree();
+	}
+	//---------------------------------------------------------------------------
+	float Control::GetOpacity() const
+	{
+		return opacity_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetRenderOffset(const Drawing::PointF &offset)
+	{
+		renderOffset_ = offset;
+
+		UpdateRenderTransformTree();
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::PointF& Control::GetRenderOffset() const
+	{
+		return renderOffset_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetRenderScale(float scale)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (scale < 0.0f)
+		{
+			throw Misc::ArgumentOutOfRangeException("scale");
+		}
+		#endif
+
+		renderScale_ = scale;
+
+		UpdateRenderTransformTree();
+	}
+	//---------------------------------------------------------------------------
+	float Control::GetRenderScale() const
+	{
+		return renderScale_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetFont(const Drawing::FontPtr &font)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (font == nullptr)
+		{
+			throw Misc::ArgumentNullException("font");
+		}
+		#endif
+		
+		font_ = font;
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::FontPtr& Control::GetFont() const
+	{
+		return font_ ? font_ : parent_ ? parent_->GetFont() : Application::Instance().GetDefaultFont();
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetCursor(const CursorPtr &cursor)
+	{
+		cursor_ = std::move(cursor);
+	}
+	//---------------------------------------------------------------------------
+	const CursorPtr& Control::GetCursor() const
+	{
+		return cursor_ ? cursor_ : GetParent() ? GetParent()->GetCursor() : Cursors::Get(Cursors::Default);
+	}
+	//---------------------------------------------------------------------------
+	LocationChangedEvent& Control::GetLocationChangedEvent()
+	{
+		return GetEvent<LocationChangedEvent>(EventType::LocationChanged);
+	}
+	//---------------------------------------------------------------------------
+	SizeChangedEvent& Control::GetSizeChangedEvent()
+	{
+		return GetEvent<SizeChangedEvent>(EventType::SizeChanged);
+	}
+	//---------------------------------------------------------------------------
+	ClickEvent& Control::GetClickEvent()
+	{
+		return GetEvent<ClickEvent>(EventType::Click);
+	}
+	//---------------------------------------------------------------------------
+	MouseClickEvent& Control::GetMouseClickEvent()
+	{
+		return GetEvent<MouseClickEvent>(EventType::MouseClick);
+	}
+	//---------------------------------------------------------------------------
+	MouseDownEvent& Control::GetMouseDownEvent()
+	{
+		return GetEvent<MouseDownEvent>(EventType::MouseDown);
+	}
+	//---------------------------------------------------------------------------
+	MouseUpEvent& Control::GetMouseUpEvent()
+	{
+		return GetEvent<MouseUpEvent>(EventType::MouseUp);
+	}
+	//---------------------------------------------------------------------------
+	MouseMoveEvent& Control::GetMouseMoveEvent()
+	{
+		return GetEvent<MouseMoveEvent>(EventType::MouseMove);
+	}
+	//---------------------------------------------------------------------------
+	MouseScrollEvent& Control::GetMouseScrollEvent()
+	{
+		return GetEvent<MouseScrollEvent>(EventType::MouseScroll);
+	}
+	//---------------------------------------------------------------------------
+	MouseEnterEvent& Control::GetMouseEnterEvent()
+	{
+		return GetEvent<MouseEnterEvent>(EventType::MouseEnter);
+	}
+	//---------------------------------------------------------------------------
+	MouseLeaveEvent& Control::GetMouseLeaveEvent()
+	{
+		return GetEvent<MouseLeaveEvent>(EventType::MouseLeave);
+	}
+	//---------------------------------------------------------------------------
+	MouseCaptureChangedEvent& Control::GetMouseCaptureChangedEvent()
+	{
+		return GetEvent<MouseCaptureChangedEvent>(EventType::MouseCaptureChanged);
+	}
+	//---------------------------------------------------------------------------
+	KeyDownEvent& Control::GetKeyDownEvent()
+	{
+		return GetEvent<KeyDownEvent>(EventType::KeyDown);
+	}
+	//---------------------------------------------------------------------------
+	KeyPressEvent& Control::GetKeyPressEvent()
+	{
+		return GetEvent<KeyPressEvent>(EventType::KeyPress);
+	}
+	//---------------------------------------------------------------------------
+	KeyUpEvent& Control::GetKeyUpEvent()
+	{
+		return GetEvent<KeyUpEvent>(EventType::KeyUp);
+	}
+	//---------------------------------------------------------------------------
+	FocusGotEvent& Control::GetFocusGotEvent()
+	{
+		return GetEvent<FocusGotEvent>(EventType::FocusGot);
+	}
+	//---------------------------------------------------------------------------
+	FocusLostEvent& Control::GetFocusLostEvent()
+	{
+		return GetEvent<FocusLostEvent>(EventType::FocusLost);
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetParent(Control *parent)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (parent == nullptr)
+		{
+			throw Misc::ArgumentNullException("parent");
+		}
+		#endif
+
+		parent_ = parent;
+
+		//die Position relativ zum neuen Elternelement sofort übernehmen, auch wenn sie sich nicht ändert
+		CalculateAbsoluteLocation();
+
+		OnLocationChanged();
+	}
+	//---------------------------------------------------------------------------
+	Control* Control::GetParent() const
+	{
+		return parent_;
+	}
+	//---------------------------------------------------------------------------
+	const ControlList& Control::GetControls() const
+	{
+		return controls_;
+	}
+	//---------------------------------------------------------------------------
+	Control::PostOrderIterator Control::GetPostOrderEnumerator()
+	{
+		return PostOrderIterator(this);
+	}
+	//---------------------------------------------------------------------------
+	void Control::GetRenderContext(Drawing::RenderContext &context) const
+	{
+		if (surface_)
+		{
+			context.Surface = surface_.get();
+			context.Owner = this;
+			context.Offset = GetLocation();
+			context.QueueType = Drawing::RenderQueueType::Base;
+		}
+		else if (GetParent())
+		{
+			GetParent()->GetRenderContext(context);
+		}
+		else
+		{
+			context.Surface = &Application::Instance().GetRenderSurface();
+			context.Owner = nullptr;
+			context.Offset = Drawing::PointF(0.0f, 0.0f);
+			context.QueueType = Drawing::RenderQueueType::Base;
+		}
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	void Control::Focus()
+	{
+		if (isFocusable_ && !isFocused_)
+		{
+			OnGotFocus(this);
+		}
+	}
+	//---------------------------------------------------------------------------
+	bool Control::Intersect(const Drawing::PointI &point) const
+	{
+		return Intersection::TestRectangle(absoluteLocation_, size_, point);
+	}
+	//---------------------------------------------------------------------------
+	Drawing::PointI Control::PointToClient(const Drawing::PointI &point) const
+	{
+		return point - absoluteLocation_;
+	}
+	//---------------------------------------------------------------------------
+	Drawing::PointI Control::PointToScreen(const Drawing::PointI &point) const
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (!parent_)
+		{
+			throw Misc::ArgumentNullException("parent");
+		}
+		#endif
+		
+		if (parent_ != this)
+		{
+			return parent_->PointToScreen(point + location_);
+		}
+
+		return point + location_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::CalculateAbsoluteLocation()
+	{
+		//der gesamte Teilbaum wird neu berechnet
+		isLocationDirty_ = false;
+		isChildLocationDirty_ = false;
+
+		if (parent_ != nullptr)
+		{
+			absoluteLocation_ = parent_->absoluteLocation_ + location_;
+		}
+		else
+		{
+			absoluteLocation_ = location_;
+		}
+
+		UpdateClip();
+		UpdateRenderTransform();
+		SetGeometryTranslation(absoluteLocation_);
+
+		UpdateHitTestEntry();
+
+		for (auto &control : internalControls_)
+		{
+			control->CalculateAbsoluteLocation();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::AddControl(Control *control)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (control == nullptr)
+		{
+			throw Misc::ArgumentNullException("control");
+		}
+		#endif
+
+		if (control->GetType() == ControlType::Form)
+		{
+			return;
+		}
+
+		AddSubControl(control);
+
+		controls_.push_back(control);
+	}
+	//---------------------------------------------------------------------------
+	void Control::RemoveControl(Control *control)
+	{
+		if (control != nullptr)
+		{
+			if (auto form = control->GetHitTestForm())
+			{
+				control->RemoveHitTestEntries(*form);
+			}
+
+			controls_.erase(std::remove(std::begin(controls_), std::end(controls_), control), std::end(controls_));
+			internalControls_.erase(std::remove(std::begin(internalControls_), std::end(internalControls_), control), std::end(internalControls_));
+			control->isInternalControl_ = false;
+
+			InvalidatePostOrder();
+
+			if (control->dock_ != DockStyle::None || layoutEngine_)
+			{
+				InvalidateLayout();
+			}
+
+			Invalidate();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::AddSubControl(Control *subcontrol)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (subcontrol == nullptr)
+		{
+			throw Misc::ArgumentNullException("subcontrol");
+		}
+		#endif
+
+		if (subcontrol->GetType() == ControlType::Form)
+		{
+			return;
+		}
+
+		for (auto &control : internalControls_)
+		{
+			if (subcontrol == control || (!subcontrol->GetName().empty() && subcontrol->GetName() == control->GetName()))
+			{
+				return;
+			}
+		}
+
+		subcontrol->SetParent(this);
+
+		internalControls_.push_back(subcontrol);
+		subcontrol->isInternalControl_ = true;
+
+		InvalidatePostOrder();
+
+		subcontrol->UpdateLayoutInfo();
+		if (subcontrol->isLayoutDirty_ || subcontrol->isChildLayoutDirty_)
+		{
+			subcontrol->PropagateLayoutRequest();
+		}
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	Drawing::RectangleI Control::GetHitTestBounds() const
+	{
+		return Drawing::RectangleI(absoluteLocation_, size_);
+	}
+	//---------------------------------------------------------------------------
+	Drawing::RectangleI Control::GetChildClip(const Control &/*child*/) const
+	{
+		return clip_.GetIntersection(Drawing::RectangleI(absoluteLocation_, size_));
+	}
+	//---------------------------------------------------------------------------
+	void Control::UpdateHitTestEntry()
+	{
+		auto form = GetHitTestForm();
+		if (form == nullptr)
+		{
+			return;
+		}
+
+		if (isVisible_)
+		{
+			//relativ zur Form speichern, damit ein Verschieben der Form das Raster nicht verändert
+			auto bounds = GetHitTestBounds();
+			bounds.Offset(-form->absoluteLocation_.X, -form->absoluteLocation_.Y);
+			form->hitTestGrid_.Update(this, bounds);
+		}
+		else
+		{
+			form->hitTestGrid_.Remove(this);
+		}
+	}
+	//---------------------------------------------------------------------------
+	Form* Control::GetHitTestForm() const
+	{
+		for (auto control = parent_; control != nullptr; control = control->parent_)
+		{
+			if (control->type_ == ControlType::Form)
+			{
+				return static_cast<Form*>(control);
+			}
+		}
+
+		return nullptr;
+	}
+	//---------------------------------------------------------------------------
+	void Control::RemoveHitTestEntries(Form &form)
+	{
+		form.hitTestGrid_.Remove(this);
+
+		for (auto &control : internalControls_)
+		{
+			control->RemoveHitTestEntries(form);
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::InvalidatePostOrder()
+	{
+		for (auto control = this; control != nullptr; control = control->parent_)
+		{
+			if (control->type_ == ControlType::Form)
+			{
+				static_cast<Form*>(control)->postOrderControlsDirty_ = true;
+				return;
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::CollectPostOrder(const Control *container, std::vector<Control*> &controls)
+	{
+		//das zuletzt hinzugefügte Steuerelement kommt zuerst
+		for (auto &control : make_reverse_range(container->internalControls_))
+		{
+			if (control->GetVisible() && control->GetEnabled())
+			{
+				CollectPostOrder(control, controls);
+
+				controls.push_back(control);
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	Control* Control::GetChildAtPoint(const Drawing::PointI &point) const
+	{
+		for (auto &control : controls_)
+		{
+			if (control->GetEnabled() && control->GetVisible() && control->Intersect(point))
+			{
+				return control;
+			}
+		}
+
+		return nullptr;
+	}
+	//---------------------------------------------------------------------------
+	Control* Control::GetChildByName(const Misc::AnsiString &name) const
+	{
+		for (auto &control : make_reverse_range(controls_))
+		{
+			if (control->GetName() == name)
+			{
+				return control;
+			}
+		}
+
+		return nullptr;
+	}
+	//---------------------------------------------------------------------------
+	void Control::InjectTime(const Misc::Clock::TimePoint &time)
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	void Control::ScheduleInjectTime(const Misc::Clock::TimePoint &deadline)
+	{
+		Application::Instance().timerScheduler_.Schedule(this, deadline);
+	}
+	//---------------------------------------------------------------------------
+	void Control::CancelInjectTime()
+	{
+		Application::Instance().timerScheduler_.Cancel(this);
+	}
+	//---------------------------------------------------------------------------
+	bool Control::IsInShownForm() const
+	{
+		auto form = type_ == ControlType::Form ? static_cast<const Form*>(this) : GetHitTestForm();
+		if (form == nullptr || !form->isVisible_)
+		{
+			return false;
+		}
+
+		for (auto it = Application::Instance().formManager_.GetEnumerator(); it(); ++it)
+		{
+			if ((*it).get() == form)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	void Control::Invalidate()
+	{
+		needsRedraw_ = true;
+
+		InvalidateSurface();
+	}
+	//---------------------------------------------------------------------------
+	void Control::InvalidateSurface()
+	{
+		auto &app = Application::Instance();
+		if (app.IsUpdating())
+		{
+			app.hasPendingInvalidations_ = true;
+		}
+		else
+		{
+			app.GetRenderSurface().Invalidate();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::InvalidateLayout()
+	{
+		isLayoutDirty_ = true;
+
+		PropagateLayoutRequest();
+	}
+	//---------------------------------------------------------------------------
+	void Control::PropagateLayoutRequest()
+	{
+		for (auto control = parent_; control != nullptr && !control->isChildLayoutDirty_; control = control->parent_)
+		{
+			control->isChildLayoutDirty_ = true;
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::SuspendLayout()
+	{
+		++layoutSuspendCount_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::ResumeLayout(bool performLayout)
+	{
+		if (layoutSuspendCount_ > 0 && --layoutSuspendCount_ == 0 && (isLayoutDirty_ || isChildLayoutDirty_))
+		{
+			if (performLayout)
+			{
+				LayoutPendingControls();
+			}
+			else
+			{
+				//der Layout-Durchlauf hat diesen Teilbaum während der Unterbrechung übersprungen
+				PropagateLayoutRequest();
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::PerformLayout()
+	{
+		InvalidateLayout();
+
+		LayoutPendingControls();
+	}
+	//---------------------------------------------------------------------------
+	void Control::LayoutPendingControls()
+	{
+		if (layoutSuspendCount_ > 0)
+		{
+			return;
+		}
+
+		if (isLayoutDirty_)
+		{
+			isLayoutDirty_ = false;
+
+			isPerformingLayout_ = true;
+			GetLayoutEngine().Layout(*this);
+			isPerformingLayout_ = false;
+		}
+
+		//Steuerelemente, deren Größe gerade geändert wurde, sind jetzt ebenfalls markiert
+		if (isChildLayoutDirty_)
+		{
+			isChildLayoutDirty_ = false;
+
+			for (auto &control : internalControls_)
+			{
+				if (control->isLayoutDirty_ || control->isChildLayoutDirty_)
+				{
+					control->LayoutPendingControls();
+				}
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::InvalidateAbsoluteLocation()
+	{
+		if (!isLocationDirty_)
+		{
+			const auto location = parent_ != nullptr ? parent_->absoluteLocation_ + location_ : location_;
+			if (location == absoluteLocation_)
+			{
+				return;
+			}
+		}
+
+		RequestLocationUpdate();
+	}
+	//---------------------------------------------------------------------------
+	void Control::RequestLocationUpdate()
+	{
+		if (parent_ != nullptr && !isInternalControl_)
+		{
+			//nicht als untergeordnetes Steuerelement eingetragen (z.B. die Beschriftung eines Buttons)
+			//und damit für UpdatePendingLocations unerreichbar
+			CalculateAbsoluteLocation();
+			return;
+		}
+
+		isLocationDirty_ = true;
+
+		for (auto control = parent_; control != nullptr && !control->isChildLocationDirty_; control = control->parent_)
+		{
+			control->isChildLocationDirty_ = true;
+		}
+
+		Application::Instance().hasPendingLocations_ = true;
+	}
+	//---------------------------------------------------------------------------
+	void Control::UpdatePendingLocations()
+	{
+		if (isLocationDirty_)
+		{
+			CalculateAbsoluteLocation();
+		}
+		else if (isChildLocationDirty_)
+		{
+			isChildLocationDirty_ = false;
+
+			for (auto &control : internalControls_)
+			{
+				if (control->isLocationDirty_ || control->isChildLocationDirty_)
+				{
+					control->UpdatePendingLocations();
+				}
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::UpdateLayoutInfo()
+	{
+		//Änderungen durch den Layout-Durchlauf selbst verschieben die Ankerabstände nicht
+		if (parent_ == nullptr || parent_->isPerformingLayout_)
+		{
+			return;
+		}
+
+		anchorDistance_ = Drawing::PointI(parent_->GetWidth() - GetRight(), parent_->GetHeight() - GetBottom());
+
+		if (dock_ != DockStyle::None || parent_->layoutEngine_)
+		{
+			parent_->InvalidateLayout();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::Render()
+	{
+		if (!isVisible_)
+		{
+			return;
+		}
+
+		using namespace Drawing;
+
+		RenderContext ctx;
+		GetRenderContext(ctx);
+
+		// clear geometry from surface if it's ours
+		if (ctx.Owner == this)
+		{
+			ctx.Surface->Reset();
+		}
+
+		// redraw if no surface set, or if surface is invalidated
+		if (!surface_)// || surface->isInvalidated())
+		{
+			DrawSelf(ctx);
+
+			Control *focusedControl = nullptr;
+			for (auto &control : controls_)
+			{
+				if (control->GetIsFocused())
+				{
+					focusedControl = control;
+				}
+				else
+				{
+					control->Render();
+				}
+			}
+			if (focusedControl != nullptr)
+			{
+				focusedControl->Render();
+			}
+		}
+
+		if (ctx.Owner == this)
+		{
+			ctx.Surface->Draw();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::DrawSelf(Drawing::RenderContext &context)
+	{
+		//untergeordnete Steuerelemente können trotzdem sichtbar sein und prüfen das selbst
+		if (isCulled_)
+		{
+			return;
+		}
+
+		BufferGeometry(context);
+		QueueGeometry(context);
+	}
+	//---------------------------------------------------------------------------
+	void Control::SetGeometryTranslation(const Drawing::PointI &location)
+	{
+		geometryTranslation_ = location;
+
+		ApplyRenderTransform();
+	}
+	//---------------------------------------------------------------------------
+	void Control::UpdateRenderTransform()
+	{
+		RenderTransform parent;
+		if (parent_ != nullptr)
+		{
+			parent = parent_->renderTransform_;
+		}
+
+		//Skalierung um den Mittelpunkt: x -> s * (x - c) + c + offset
+		const auto centerX = absoluteLocation_.X + size_.Width * 0.5f;
+		const auto centerY = absoluteLocation_.Y + size_.Height * 0.5f;
+		const auto offsetX = centerX * (1.0f - renderScale_) + renderOffset_.X;
+		const auto offsetY = centerY * (1.0f - renderScale_) + renderOffset_.Y;
+
+		renderTransform_.Scale = parent.Scale * renderScale_;
+		renderTransform_.Offset = Drawing::PointF(parent.Scale * offsetX + parent.Offset.X, parent.Scale * offsetY + parent.Offset.Y);
+		renderTransform_.Opacity = parent.Opacity * opacity_;
+
+		ApplyRenderTransform();
+	}
+	//---------------------------------------------------------------------------
+	void Control::UpdateClip()
+	{
+		clip_ = parent_ != nullptr ? parent_->GetChildClip(*this) : Unclipped;
+
+		const auto visible = clip_.GetIntersection(Drawing::RectangleI(absoluteLocation_, size_));
+		const auto culled = visible.GetWidth() <= 0 || visible.GetHeight() <= 0;
+		if (culled != isCulled_)
+		{
+			isCulled_ = culled;
+
+			//nur die Menge der gezeichneten Geometrie ändert sich
+			InvalidateSurface();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::UpdateRenderTransformTree()
+	{
+		UpdateRenderTransform();
+
+		for (auto &control : internalControls_)
+		{
+			control->UpdateRenderTransformTree();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::ApplyRenderTransform()
+	{
+		if (geometry_)
+		{
+			const auto &transform = renderTransform_;
+			geometry_->SetTranslation(Drawing::Vector(geometryTranslation_.X * transform.Scale + transform.Offset.X, geometryTranslation_.Y * transform.Scale + transform.Offset.Y, 0.0f));
+			geometry_->SetScale(Drawing::Vector(transform.Scale, transform.Scale, 1.0f));
+			geometry_->SetAlpha(transform.Opacity);
+
+			//der Clipping-Bereich stammt von den übergeordneten Steuerelementen und wird mit deren Transformation gezeichnet
+			const auto clipped = clip_ != Unclipped;
+			if (clipped)
+			{
+				RenderTransform parent;
+				if (parent_ != nullptr)
+				{
+					parent = parent_->renderTransform_;
+				}
+				geometry_->SetClippingRegion(Drawing::RectangleF(clip_.GetLeft() * parent.Scale + parent.Offset.X, clip_.GetTop() * parent.Scale + parent.Offset.Y, clip_.GetWidth() * parent.Scale, clip_.GetHeight() * parent.Scale));
+			}
+			if (geometry_->IsClippingActive() != clipped)
+			{
+				//die Batches übernehmen den Zustand beim Hinzufügen der Vertices
+				geometry_->SetClippingActive(clipped);
+				Invalidate();
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::BufferGeometry(Drawing::RenderContext &context)
+	{
+		if (!geometry_)
+		{
+			geometry_ = Application::Instance().GetRenderer().CreateGeometryBuffer();
+			geometry_->SetClippingActive(clip_ != Unclipped);
+			ApplyRenderTransform();
+
+			needsRedraw_ = true;
+		}
+
+		if (needsRedraw_)
+		{
+			geometry_->Reset();
+
+			PopulateGeometry();
+
+			needsRedraw_ = false;
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::QueueGeometry(Drawing::RenderContext &context)
+	{
+		context.Surface->AddGeometry(context.QueueType, geometry_);
+	}
+	//---------------------------------------------------------------------------
+	void Control::PopulateGeometry()
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	void Control::ApplyStyle(const Drawing::Style &style)
+	{
+		auto &controlStyle = style.GetControlStyle(type_);
+		SetForeColor(controlStyle.ForeColor);
+		SetBackColor(controlStyle.BackColor);
+		if (controlStyle.Font && controlStyle.Font != font_)
+		{
+			SetFont(controlStyle.Font);
+		}
+
+		for (auto &control : GetControls())
+		{
+			control->ApplyStyle(style);
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::ApplyStyleChanges(const Drawing::Style &previous, const Drawing::Style &style)
+	{
+		auto &before = previous.GetControlStyle(type_);
+		auto &controlStyle = style.GetControlStyle(type_);
+		if (before.ForeColor != controlStyle.ForeColor)
+		{
+			SetForeColor(controlStyle.ForeColor);
+		}
+		if (before.BackColor != controlStyle.BackColor)
+		{
+			SetBackColor(controlStyle.BackColor);
+		}
+		if (controlStyle.Font && before.Font != controlStyle.Font)
+		{
+			SetFont(controlStyle.Font);
+		}
+
+		for (auto &control : GetControls())
+		{
+			control->ApplyStyleChanges(previous, style);
+		}
+	}
+	//---------------------------------------------------------------------------
+	//Event-Handling
+	//---------------------------------------------------------------------------
+	void Control::OnLocationChanged()
+	{
+		//die Geometrie liegt in lokalen Koordinaten, ein Verschieben ändert nur ihre Translation
+		InvalidateAbsoluteLocation();
+	
+		InvokeEvent<LocationChangedEvent>(EventType::LocationChanged, this);
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnSizeChanged()
+	{
+		InvokeEvent<SizeChangedEvent>(EventType::SizeChanged, this);
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnMouseDown(const MouseMessage &mouse)
+	{
+		isClicked_ = true;
+
+		Invalidate();
+
+		MouseEventArgs args(mouse);
+		args.Location -= absoluteLocation_;
+		InvokeEvent<MouseDownEvent>(EventType::MouseDown, this, args);
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnMouseClick(const MouseMessage &mouse)
+	{
+		MouseEventArgs args(mouse);
+		args.Location -= absoluteLocation_;
+		InvokeEvent<MouseClickEvent>(EventType::MouseClick, this, args);
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnMouseUp(const MouseMessage &mouse)
+	{
+		isClicked_ = false;
+
+		Invalidate();
+
+		MouseEventArgs args(mouse);
+		args.Location -= absoluteLocation_;
+		InvokeEvent<MouseUpEvent>(EventType::MouseUp, this, args);
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnMouseMove(const MouseMessage &mouse)
+	{
+		MouseEventArgs args(mouse);
+		args.Location -= absoluteLocation_;
+		InvokeEvent<MouseMoveEvent>(EventType::MouseMove, this, args);
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnMouseScroll(const MouseMessage &mouse)
+	{
+		MouseEventArgs args(mouse);
+		args.Location -= absoluteLocation_;
+		InvokeEvent<MouseScrollEvent>(EventType::MouseScroll, this, args);
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnMouseEnter(const MouseMessage &mouse)
+	{
+		isInside_ = true;
+
+		auto &app = Application::Instance();
+
+		if (app.MouseEnteredControl != nullptr && app.MouseEnteredControl->isInside_)
+		{
+			app.MouseEnteredControl->OnMouseLeave(mouse);
+		}
+		app.MouseEnteredControl = this;
+
+		InvokeEvent<MouseEnterEvent>(EventType::MouseEnter, this);
+
+		Invalidate();
+
+		app.SetCursor(GetCursor());
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnMouseLeave(const MouseMessage &mouse)
+	{
+		isInside_ = false;
+
+		Application::Instance().MouseEnteredControl = nullptr;
+
+		InvokeEvent<MouseLeaveEvent>(EventType::MouseLeave, this);
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnGotMouseCapture()
+	{
+		auto &app = Application::Instance();
+		if (app.CaptureControl != nullptr)
+		{
+			app.CaptureControl->OnLostMouseCapture();
+		}
+		app.CaptureControl = this;
+		hasCaptured_ = true;
+
+		isClicked_ = false;
+
+		InvokeEvent<MouseCaptureChangedEvent>(EventType::MouseCaptureChanged, this);
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnLostMouseCapture()
+	{
+		hasCaptured_ = false;
+
+		Application::Instance().CaptureControl = nullptr;
+
+		InvokeEvent<MouseCaptureChangedEvent>(EventType::MouseCaptureChanged, this);
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnGotFocus(Control *newFocusedControl)
+	{
+		auto &app = Application::Instance();
+		if (newFocusedControl != app.FocusedControl)
+		{
+			if (app.FocusedControl != nullptr)
+			{
+				app.FocusedControl->OnLostFocus(newFocusedControl);
+			}
+
+			app.FocusedControl = newFocusedControl;
+			isFocused_ = true;
+
+			InvokeEvent<FocusGotEvent>(EventType::FocusGot, this);
+
+			Invalidate();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Control::OnLostFocus(Control *newFocusedControl)
+	{
+		isFocused_ = isClicked_ = false;
+		
+		Application::Instance().FocusedControl = nullptr;
+
+		InvokeEvent<FocusLostEvent>(EventType::FocusLost, this, newFocusedControl);
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	bool Control::OnKeyDown(const KeyboardMessage &keyboard)
+	{
+		KeyEventArgs args(keyboard);
+		InvokeEvent<KeyDownEvent>(EventType::KeyDown, this, args);
+
+		return args.Handled;
+	}
+	//---------------------------------------------------------------------------
+	bool Control::OnKeyPress(const KeyboardMessage &keyboard)
+	{
+		KeyPressEventArgs args(keyboard);
+		InvokeEvent<KeyPressEvent>(EventType::KeyPress, this, args);
+
+		return args.Handled;
+	}
+	//---------------------------------------------------------------------------
+	bool Control::OnKeyUp(const KeyboardMessage &keyboard)
+	{
+		KeyEventArgs args(keyboard);
+		InvokeEvent<KeyUpEvent>(EventType::KeyUp, this, args);
+
+		return args.Handled;
+	}
+	//---------------------------------------------------------------------------
+	bool Control::ProcessMouseMessage(const MouseMessage &mouse)
+	{
+		switch (mouse.GetState())
+		{
+			case MouseState::Down:
+				if (canRaiseEvents_ && Intersect(mouse.GetLocation()))
+				{
+					if (mouse.GetButton() == MouseButton::Left && !isClicked_ && isEnabled_)
+					{
+						OnMouseDown(mouse);
+						
+						if (isFocusable_ && !isFocused_)
+						{
+							OnGotFocus(this);
+						}
+					}
+
+					return true;
+				}
+				break;
+			case MouseState::Up:
+				if (canRaiseEvents_ && (hasCaptured_ || Intersect(mouse.GetLocation())))
+				{
+					if (isClicked_)
+					{
+						if (mouse.GetButton() == MouseButton::Left)
+						{
+							InvokeEvent<ClickEvent>(EventType::Click, this);
+
+							OnMouseClick(mouse);
+						}
+					}
+
+					OnMouseUp(mouse);
+
+					return true;
+				}
+				break;
+			case MouseState::Move:
+				if (hasCaptured_ || Intersect(mouse.GetLocation()))
+				{
+					if (canRaiseEvents_)
+					{
+						if (!isInside_)
+						{
+							OnMouseEnter(mouse);
+						}
+
+						OnMouseMove(mouse);
+					}
+
+					return true;
+				}
+				break;
+			case MouseState::Scroll:
+				if (hasCaptured_ || isFocused_)
+				{
+					if (canRaiseEvents_)
+					{
+						if (mouse.GetDelta() != 0)
+						{
+							OnMouseScroll(mouse);
+						}
+					}
+
+					return true;
+				}
+				break;
+		}
+
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	bool Control::ProcessKeyboardMessage(const KeyboardMessage &keyboard)
+	{
+		if (canRaiseEvents_)
+		{
+			switch (keyboard.GetState())
+			{
+				case KeyboardState::KeyDown:
+					return OnKeyDown(keyboard);
+				case KeyboardState::KeyUp:
+					return OnKeyUp(keyboard);
+				case KeyboardState::Character:
+					return OnKeyPress(keyboard);
+			}
+		}
+		
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	//Control::PostOrderIterator
+	//---------------------------------------------------------------------------
+	Control::PostOrderIterator::PostOrderIterator(Control *start)
+		: formControls_(nullptr),
+		  index_(0)
+	{
+		if (start->type_ == ControlType::Form)
+		{
+			formControls_ = &static_cast<Form*>(start)->GetPostOrderControls();
+		}
+		else
+		{
+			CollectPostOrder(start, controls_);
+		}
+	}
+	//---------------------------------------------------------------------------
+	const std::vector<Control*>& Control::PostOrderIterator::GetControls() const
+	{
+		return formControls_ != nullptr ? *formControls_ : controls_;
+	}
+	//---------------------------------------------------------------------------
+	void Control::PostOrderIterator::operator++()
+	{
+		++index_;
+	}
+	//---------------------------------------------------------------------------
+	bool Control::PostOrderIterator::operator()()
+	{
+		return index_ < GetControls().size();
+	}
+	//---------------------------------------------------------------------------
+	Control* Control::PostOrderIterator::operator*()
+	{
+		return GetControls()[index_];
+	}
+	//---------------------------------------------------------------------------
+}
@@ -1,77 +1,77 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#include "Label.hpp"
-#include "../Misc/Exceptions.hpp"
-
-namespace OSHGui
-{
-	//---------------------------------------------------------------------------
-	//Constructor
-	//---------------------------------------------------------------------------
-	Label::Label()
-		: textHelper_(GetFont())
-	{
-		type_ = ControlType::Label;
-		
-		SetAutoSize(true);
-		
-		ApplyStyle(Application::Instance().GetStyle());
-
-		canRaiseEvents_ = false;
-	}
-	//---------------------------------------------------------------------------
-	//Getter/Setter
-	//---------------------------------------------------------------------------
-	void Label::SetText(const Misc::AnsiString &text)
-	{
-		textHelper_.SetText(text);
-		if (autoSize_)
-		{
-			Control::SetSize(textHelper_.GetSize());
-		}
-	}
-	//---------------------------------------------------------------------------
-	const Misc::AnsiString& Label::GetText() const
-	{
-		return textHelper_.GetText();
-	}
-	//---------------------------------------------------------------------------
-	void Label::SetFont(const Drawing::FontPtr &font)
-	{
-		Control::SetFont(font);
-
-		textHelper_.SetFont(font);
-		if (autoSize_)
-		{
-			Control::SetSize(textHelper_.GetSize());
-		}
-	}
-	//---------------------------------------------------------------------------
-	//Runtime-Functions
-	//---------------------------------------------------------------------------
-	bool Label::Intersect(const Drawing::PointI &point) const
-	{
-		return false;
-	}
-	//---------------------------------------------------------------------------
-	void Label::PopulateGeometry()
-	{
-		using namespace Drawing;
-
-		Graphics g(*geometry_);
-
-		if (GetBackColor().GetAlpha() > 0)
-		{
-			g.FillRectangle(GetBackColor(), RectangleF(PointF(), GetSize()));
-		}
-		
-		g.DrawString(textHelper_.GetText(), GetFont(), GetForeColor(), PointF(0, 0));
-	}
-	//---------------------------------------------------------------------------
-}
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Label.hpp"
+#include "../Misc/Exceptions.hpp"
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	Label::Label()
+		: textHelper_(GetFont())
+	{
+		type_ = ControlType::Label;
+		
+		SetAutoSize(true);
+		
+		ApplyStyle(Application::Instance().GetStyle());
+
+		canRaiseEvents_ = false;
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	void Label::SetText(const Misc::AnsiString &text)
+	{
+		textHelper_.SetText(text);
+		if (autoSize_)
+		{
+			Control::SetSize(textHelper_.GetSize());
+		}
+	}
+	//---------------------------------------------------------------------------
+	const Misc::AnsiString& Label::GetText() const
+	{
+		return textHelper_.GetText();
+	}
+	//---------------------------------------------------------------------------
+	void Label::SetFont(const Drawing::FontPtr &font)
+	{
+		Control::SetFont(font);
+
+		textHelper_.SetFont(font);
+		if (autoSize_)
+		{
+			Control::SetSize(textHelper_.GetSize());
+		}
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	bool Label::Intersect(const Drawing::PointI &point) const
+	{
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	void Label::PopulateGeometry()
+	{
+		using namespace Drawing;
+
+		Graphics g(*geometry_);
+
+		if (GetBackColor().GetAlpha() > 0)
+		{
+			g.FillRectangle(GetBackColor(), RectangleF(PointF(), GetSize()));
+		}
+		
+		g.DrawString(textHelper_.GetText(), GetFont(), GetForeColor(), PointF(0, 0));
+	}
+	//---------------------------------------------------------------------------
+}
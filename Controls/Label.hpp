@@ -1,62 +1,62 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_LABEL_HPP
-#define OSHGUI_LABEL_HPP
-
-#include "Control.hpp"
-#include "../Misc/TextHelper.hpp"
-
-namespace OSHGui
-{
-	/**
-	 * Stellt ein Label-Steuerelement dar.
-	 */
-	class OSHGUI_EXPORT Label : public Control
-	{
-	public:
-		/**
-		 * Konstruktor der Klasse.
-		 */
-		Label();
-		
-		/**
-		 * Legt den Text fest. Falls autoSize = true, wird die Gre automatisch angepasst.
-		 *
-		 * \param text
-		 */
-		void SetText(const Misc::AnsiString &text);
-		/**
-		 * Ruft den Text ab.
-		 *
-		 * \return der Text
-		 */
-		const Misc::AnsiString& GetText() const;
-		/**
-		 * Legt die Schriftart des Texts im Steuerelement fest.
-		 *
-		 * \param font
-		 */
-		virtual void SetFont(const Drawing::FontPtr &font) override;
-		
-		/**
-		 * berprft, ob sich der Punkt innerhalb des Steuerelements befindet.
-		 *
-		 * \param point
-		 * \return ja / nein
-		 */
-		virtual bool Intersect(const Drawing::PointI &point) const override;
-		
-	protected:
-		virtual void PopulateGeometry() override;
-
-		Misc::TextHelper textHelper_;
-	};
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_LABEL_HPP
+#define OSHGUI_LABEL_HPP
+
+#include "Control.hpp"
+#include "../Misc/TextHelper.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Stellt ein Label-Steuerelement dar.
+	 */
+	class OSHGUI_EXPORT Label : public Control
+	{
+	public:
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		Label();
+		
+		/**
+		 * Legt den Text fest. Falls autoSize = true, wird die Größe automatisch angepasst.
+		 *
+		 * \param text
+		 */
+		void SetText(const Misc::AnsiString &text);
+		/**
+		 * Ruft den Text ab.
+		 *
+		 * \return der Text
+		 */
+		const Misc::AnsiString& GetText() const;
+		/**
+		 * Legt die Schriftart des Texts im Steuerelement fest.
+		 *
+		 * \param font
+		 */
+		virtual void SetFont(const Drawing::FontPtr &font) override;
+		
+		/**
+		 * Überprüft, ob sich der Punkt innerhalb des Steuerelements befindet.
+		 *
+		 * \param point
+		 * \return ja / nein
+		 */
+		virtual bool Intersect(const Drawing::PointI &point) const override;
+		
+	protected:
+		virtual void PopulateGeometry() override;
+
+		Misc::TextHelper textHelper_;
+	};
+}
+
 #endif
\ No newline at end of file
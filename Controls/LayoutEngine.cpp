@@ -0,0 +1,240 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "LayoutEngine.hpp"
+#include "Control.hpp"
+#include <algorithm>
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//LayoutEngine
+	//---------------------------------------------------------------------------
+	LayoutEngine::~LayoutEngine()
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	Drawing::SizeI LayoutEngine::Measure(const Control &container) const
+	{
+		return container.GetSize();
+	}
+	//---------------------------------------------------------------------------
+	const ControlList& LayoutEngine::GetLayoutControls(const Control &container)
+	{
+		return container.controls_;
+	}
+	//---------------------------------------------------------------------------
+	const Drawing::PointI& LayoutEngine::GetAnchorDistance(const Control &control)
+	{
+		return control.anchorDistance_;
+	}
+	//---------------------------------------------------------------------------
+	//DefaultLayout
+	//---------------------------------------------------------------------------
+	DefaultLayout& DefaultLayout::Instance()
+	{
+		static DefaultLayout instance;
+		return instance;
+	}
+	//---------------------------------------------------------------------------
+	void DefaultLayout::Layout(Control &container)
+	{
+		const auto &size = container.GetSize();
+
+		auto left = 0;
+		auto top = 0;
+		auto right = size.Width;
+		auto bottom = size.Height;
+
+		//controls_ enthält die Steuerelemente in der Reihenfolge, in der sie hinzugefügt wurden
+		for (auto &control : GetLayoutControls(container))
+		{
+			if (!control->GetVisible())
+			{
+				continue;
+			}
+
+			const auto width = std::max(0, right - left);
+			const auto height = std::max(0, bottom - top);
+
+			switch (control->GetDock())
+			{
+				case DockStyle::Top:
+				{
+					const auto h = std::min(control->GetHeight(), height);
+					control->SetBounds(left, top, width, h);
+					top += h;
+					break;
+				}
+				case DockStyle::Bottom:
+				{
+					const auto h = std::min(control->GetHeight(), height);
+					control->SetBounds(left, bottom - h, width, h);
+					bottom -= h;
+					break;
+				}
+				case DockStyle::Left:
+				{
+					const auto w = std::min(control->GetWidth(), width);
+					control->SetBounds(left, top, w, height);
+					left += w;
+					break;
+				}
+				case DockStyle::Right:
+				{
+					const auto w = std::min(control->GetWidth(), width);
+					control->SetBounds(right - w, top, w, height);
+					right -= w;
+					break;
+				}
+				case DockStyle::Fill:
+					control->SetBounds(left, top, width, height);
+					break;
+				case DockStyle::None:
+				{
+					const auto anchor = control->GetAnchor();
+					const auto &distance = GetAnchorDistance(*control);
+
+					auto location = control->GetLocation();
+					auto controlSize = control->GetSize();
+
+					if ((anchor & AnchorStyles::Right) == AnchorStyles::Right)
+					{
+						if ((anchor & AnchorStyles::Left) == AnchorStyles::Left)
+						{
+							controlSize.Width = std::max(0, size.Width - distance.X - location.X);
+						}
+						else
+						{
+							location.X = size.Width - distance.X - controlSize.Width;
+						}
+					}
+					if ((anchor & AnchorStyles::Bottom) == AnchorStyles::Bottom)
+					{
+						if ((anchor & AnchorStyles::Top) == AnchorStyles::Top)
+						{
+							controlSize.Height = std::max(0, size.Height - distance.Y - location.Y);
+						}
+						else
+						{
+							location.Y = size.Height - distance.Y - controlSize.Height;
+						}
+					}
+
+					if (location != control->GetLocation())
+					{
+						control->SetLocation(location);
+					}
+					if (controlSize != control->GetSize())
+					{
+						control->SetSize(controlSize);
+					}
+					break;
+				}
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	//StackLayout
+	//---------------------------------------------------------------------------
+	StackLayout::StackLayout(Orientation orientation, int spacing, int padding, bool stretch)
+		: orientation_(orientation),
+		  spacing_(spacing),
+		  padding_(padding),
+		  stretch_(stretch)
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	StackLayout::Orientation StackLayout::GetOrientation() const
+	{
+		return orientation_;
+	}
+	//---------------------------------------------------------------------------
+	int StackLayout::GetSpacing() const
+	{
+		return spacing_;
+	}
+	//---------------------------------------------------------------------------
+	int StackLayout::GetPadding() const
+	{
+		return padding_;
+	}
+	//---------------------------------------------------------------------------
+	bool StackLayout::GetStretch() const
+	{
+		return stretch_;
+	}
+	//---------------------------------------------------------------------------
+	Drawing::SizeI StackLayout::Measure(const Control &container) const
+	{
+		auto length = 0;
+		auto thickness = 0;
+		auto count = 0;
+
+		for (auto &control : GetLayoutControls(container))
+		{
+			if (!control->GetVisible())
+			{
+				continue;
+			}
+
+			const auto preferred = control->GetPreferredSize();
+			if (orientation_ == Orientation::Vertical)
+			{
+				length += preferred.Height;
+				thickness = std::max(thickness, preferred.Width);
+			}
+			else
+			{
+				length += preferred.Width;
+				thickness = std::max(thickness, preferred.Height);
+			}
+			++count;
+		}
+
+		if (count > 1)
+		{
+			length += spacing_ * (count - 1);
+		}
+
+		return orientation_ == Orientation::Vertical
+			? Drawing::SizeI(thickness + padding_ * 2, length + padding_ * 2)
+			: Drawing::SizeI(length + padding_ * 2, thickness + padding_ * 2);
+	}
+	//---------------------------------------------------------------------------
+	void StackLayout::Layout(Control &container)
+	{
+		const auto vertical = orientation_ == Orientation::Vertical;
+		const auto available = std::max(0, (vertical ? container.GetWidth() : container.GetHeight()) - padding_ * 2);
+
+		auto position = padding_;
+
+		for (auto &control : GetLayoutControls(container))
+		{
+			if (!control->GetVisible())
+			{
+				continue;
+			}
+
+			const auto preferred = control->GetPreferredSize();
+			if (vertical)
+			{
+				control->SetBounds(padding_, position, stretch_ ? available : preferred.Width, preferred.Height);
+				position += control->GetHeight() + spacing_;
+			}
+			else
+			{
+				control->SetBounds(position, padding_, preferred.Width, stretch_ ? available : preferred.Height);
+				position += control->GetWidth() + spacing_;
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+}
@@ -0,0 +1,100 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_LAYOUTENGINE_HPP
+#define OSHGUI_LAYOUTENGINE_HPP
+
+#include "Control.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Ordnet die untergeordneten Steuerelemente eines Containers an. Measure berechnet die
+	 * benötigte Größe, Layout setzt die Position und Größe der Steuerelemente.
+	 */
+	class OSHGUI_EXPORT LayoutEngine
+	{
+	public:
+		virtual ~LayoutEngine();
+
+		/**
+		 * Berechnet die Größe, die der Container für seine Steuerelemente benötigt.
+		 *
+		 * \param container
+		 * \return size
+		 */
+		virtual Drawing::SizeI Measure(const Control &container) const;
+		/**
+		 * Ordnet die Steuerelemente des Containers an.
+		 *
+		 * \param container
+		 */
+		virtual void Layout(Control &container) = 0;
+
+	protected:
+		static const ControlList& GetLayoutControls(const Control &container);
+		static const Drawing::PointI& GetAnchorDistance(const Control &control);
+	};
+
+	/**
+	 * Standardanordnung: angedockte Steuerelemente werden in der Reihenfolge, in der sie
+	 * hinzugefügt wurden, an die Ränder gelegt, alle anderen folgen ihren Ankern.
+	 */
+	class OSHGUI_EXPORT DefaultLayout : public LayoutEngine
+	{
+	public:
+		/**
+		 * Ruft die gemeinsame Instanz ab.
+		 *
+		 * \return instance
+		 */
+		static DefaultLayout& Instance();
+
+		virtual void Layout(Control &container) override;
+	};
+
+	/**
+	 * Ordnet die sichtbaren Steuerelemente in der Reihenfolge, in der sie hinzugefügt wurden,
+	 * unter- bzw. nebeneinander an.
+	 */
+	class OSHGUI_EXPORT StackLayout : public LayoutEngine
+	{
+	public:
+		enum class Orientation
+		{
+			Vertical,
+			Horizontal
+		};
+
+		/**
+		 * Konstruktor der Klasse.
+		 *
+		 * \param orientation
+		 * \param spacing Abstand zwischen den Steuerelementen
+		 * \param padding Abstand zum Rand des Containers
+		 * \param stretch streckt die Steuerelemente quer zur Richtung auf die Größe des Containers
+		 */
+		StackLayout(Orientation orientation = Orientation::Vertical, int spacing = 6, int padding = 0, bool stretch = true);
+
+		Orientation GetOrientation() const;
+		int GetSpacing() const;
+		int GetPadding() const;
+		bool GetStretch() const;
+
+		virtual Drawing::SizeI Measure(const Control &container) const override;
+		virtual void Layout(Control &container) override;
+
+	private:
+		Orientation orientation_;
+		int spacing_;
+		int padding_;
+		bool stretch_;
+	};
+}
+
+#endif
@@ -1,34 +1,34 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_LINKLABEL_HPP
-#define OSHGUI_LINKLABEL_HPP
-
-#include "Label.hpp"
-
-namespace OSHGui
-{
-	/**
-	 * Stellt ein Label-Steuerelement dar, das Links anzeigen kann.
-	 */
-	class OSHGUI_EXPORT LinkLabel : public Label
-	{
-	public:
-		/**
-		 * Konstruktor der Klasse.
-		 */
-		LinkLabel();
-
-		virtual bool Intersect(const Drawing::PointI &point) const override;
-
-	protected:
-		virtual void PopulateGeometry() override;
-	};
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_LINKLABEL_HPP
+#define OSHGUI_LINKLABEL_HPP
+
+#include "Label.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Stellt ein Label-Steuerelement dar, das Links anzeigen kann.
+	 */
+	class OSHGUI_EXPORT LinkLabel : public Label
+	{
+	public:
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		LinkLabel();
+
+		virtual bool Intersect(const Drawing::PointI &point) const override;
+
+	protected:
+		virtual void PopulateGeometry() override;
+	};
+}
+
 #endif
\ No newline at end of file
@@ -1,197 +1,311 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_LISTBOX_HPP
-#define OSHGUI_LISTBOX_HPP
-
-#include "Control.hpp"
-
-namespace OSHGui
-{
-	class ScrollBar;
-	class ListItem;
-
-	/**
-	 * Tritt ein, wenn sich der Wert der SelectedIndex-Eigenschaft ndert.
-	 */
-	typedef Event<void(Control*)> SelectedIndexChangedEvent;
-	typedef EventHandler<void(Control*)> SelectedIndexChangedEventHandler;
-
-	/**
-	 * Stellt ein Steuerlement zum Anzeigen einer Liste von Elementen dar.
-	 */
-	class OSHGUI_EXPORT ListBox : public Control
-	{
-	public:
-		using Control::SetSize;
-
-		/**
-		 * Konstruktor der Klasse.
-		 */
-		ListBox();
-		virtual ~ListBox();
-		
-		/**
-		 * Legt die Hhe und Breite des Steuerelements fest.
-		 *
-		 * \param size
-		 */
-		virtual void SetSize(const Drawing::SizeI &size) override;
-		/**
-		 * Legt die Schriftart des Texts im Steuerelement fest.
-		 *
-		 * \param font
-		 */
-		virtual void SetFont(const Drawing::FontPtr &font) override;
-		/**
-		 * Legt fest, ob die ListBox automatisch zum Element scrollen soll, wenn es hinzugefgt wird.
-		 *
-		 * \param autoScrollEnabled
-		 */
-		void SetAutoScrollEnabled(bool autoScrollEnabled);
-		/**
-		 * Ruft ab, ob die ListBox automatisch zum Element scrollen soll, wenn es hinzugefgt wird.
-		 *
-		 * \return autoScrollEnabled
-		 */
-		bool GetAutoScrollEnabled() const;
-		/**
-		 * Gibt das Item an der Stelle index zurck.
-		 *
-		 * \param index
-		 * \return das Item
-		 */
-		ListItem* GetItem(int index) const;
-		/**
-		 * Legt den ausgewhlten Index fest.
-		 *
-		 * \param index
-		 */
-		void SetSelectedIndex(int index);
-		/**
-		 * Gibt den ausgewhlten Index zurck.
-		 *
-		 * \return der ausgewhlte Index
-		 */
-		int GetSelectedIndex() const;
-		/**
-		 * Legt das ausgewhlte Item fest.
-		 *
-		 * \param item
-		 */
-		void SetSelectedItem(const Misc::AnsiString &item);
-		/**
-		 * Ruft das ausgewhlte Item ab.
-		 *
-		 * \return das Item
-		 */
-		ListItem* GetSelectedItem() const;
-		/**
-		 * Gibt die Anzahl der Items zurck.
-		 *
-		 * \return Anzahl der Items
-		 */
-		int GetItemsCount() const;
-		/**
-		 * Ruft das SelectedIndexEvent fr das Steuerelement ab.
-		 *
-		 * \return selectedIndexEvent
-		 */
-		SelectedIndexChangedEvent& GetSelectedIndexChangedEvent();
-		/**
-		 * Erweitert die Gre damit die angegebene Anzahl an Items sichtbar ist.
-		 */
-		void ExpandSizeToShowItems(int count);
-
-		/**
-		 * Fgt ein neues Item hinzu.
-		 *
-		 * \param text der Text des Items
-		 */
-		void AddItem(const Misc::AnsiString &text);
-		void AddItem(ListItem *item);
-		/**
-		 * Fgt ein neues Item am gewhlten Index hinzu.
-		 *
-		 * \param index
-		 * \param text der Text des Items
-		 */
-		void InsertItem(int index, const Misc::AnsiString &text);
-		void InsertItem(int index, ListItem *item);
-		/**
-		 * Lscht das Item am gewhlten Index.
-		 *
-		 * \param index
-		 */
-		void RemoveItem(int index);
-		/**
-		 * Lscht alle Items.
-		 */
-		void Clear();
-
-		/**
-		 * berprft, ob sich der Punkt innerhalb des Steuerelements befindet.
-		 *
-		 * \param point
-		 * \return ja / nein
-		 */
-		virtual bool Intersect(const Drawing::PointI &point) const override;
-
-		virtual void DrawSelf(Drawing::RenderContext &context) override;
-	
-	protected:
-		virtual void PopulateGeometry() override;
-
-		virtual void OnMouseClick(const MouseMessage &mouse) override;
-		virtual void OnMouseScroll(const MouseMessage &mouse) override;
-		virtual bool OnKeyDown(const KeyboardMessage &keyboard) override;
-		virtual bool OnKeyPress(const KeyboardMessage &keyboard) override;
-
-	private:
-		static const Drawing::SizeI DefaultSize;
-		static const Drawing::SizeI DefaultItemAreaPadding;
-		static const int DefaultItemPadding;
-
-		void CheckForScrollBar();
-		
-		int selectedIndex_;
-		int firstVisibleItemIndex_;
-		int maxVisibleItems_;
-		bool autoScrollEnabled_;
-		
-		Drawing::RectangleI itemsRect_;
-		Drawing::SizeI itemAreaSize_;
-		
-		std::vector<ListItem*> items_;
-
-		SelectedIndexChangedEvent selectedIndexChangedEvent_;
-
-		ScrollBar *scrollBar_;
-	};
-
-	class OSHGUI_EXPORT ListItem
-	{
-	public:
-		virtual ~ListItem() = default;
-
-		virtual const Misc::AnsiString& GetItemText() const = 0;
-	};
-
-	class OSHGUI_EXPORT StringListItem : public ListItem
-	{
-	public:
-		StringListItem(const Misc::AnsiString &text);
-
-		virtual const Misc::AnsiString& GetItemText() const override;
-
-	protected:
-		Misc::AnsiString text;
-	};
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_LISTBOX_HPP
+#define OSHGUI_LISTBOX_HPP
+
+#include <memory>
+#include <functional>
+#include "Control.hpp"
+#include "../Misc/PrefixIndex.hpp"
+
+namespace OSHGui
+{
+	class ScrollBar;
+
+	class OSHGUI_EXPORT ListItem
+	{
+	public:
+		virtual ~ListItem() = default;
+
+		/**
+		 * Items werden wie Steuerelemente aus Pools fester Größenklassen angelegt.
+		 */
+		static void* operator new(std::size_t size)
+		{
+			return Misc::MemoryPool::AllocateSized(size);
+		}
+		static void operator delete(void *memory, std::size_t size)
+		{
+			Misc::MemoryPool::DeallocateSized(memory, size);
+		}
+
+		/**
+		 * Ruft den Text des Items ab. Ändert er sich, während das Item in einer ListBox liegt,
+		 * muss ListBox::RefreshItem aufgerufen werden, sonst findet die Schnellsuche das Item nicht.
+		 *
+		 * \return der Text
+		 */
+		virtual const Misc::AnsiString& GetItemText() const = 0;
+	};
+
+	class OSHGUI_EXPORT StringListItem : public ListItem
+	{
+	public:
+		StringListItem(const Misc::AnsiString &text);
+
+		virtual const Misc::AnsiString& GetItemText() const override;
+
+	protected:
+		Misc::AnsiString text;
+	};
+
+	/**
+	 * Tritt ein, wenn sich der Wert der SelectedIndex-Eigenschaft ändert.
+	 */
+	typedef Event<void(Control*)> SelectedIndexChangedEvent;
+	typedef EventHandler<void(Control*)> SelectedIndexChangedEventHandler;
+
+	/**
+	 * Liefert im virtuellen Modus die Anzahl der Items.
+	 */
+	typedef std::function<int()> VirtualItemCountProvider;
+	/**
+	 * Liefert im virtuellen Modus den Text des Items am angegebenen Index.
+	 */
+	typedef std::function<Misc::AnsiString(int index)> VirtualItemTextProvider;
+
+	/**
+	 * Stellt ein Steuerlement zum Anzeigen einer Liste von Elementen dar.
+	 */
+	class OSHGUI_EXPORT ListBox : public Control
+	{
+	public:
+		using Control::SetSize;
+
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		ListBox();
+		virtual ~ListBox();
+		
+		/**
+		 * Legt die Höhe und Breite des Steuerelements fest.
+		 *
+		 * \param size
+		 */
+		virtual void SetSize(const Drawing::SizeI &size) override;
+		/**
+		 * Legt die Schriftart des Texts im Steuerelement fest.
+		 *
+		 * \param font
+		 */
+		virtual void SetFont(const Drawing::FontPtr &font) override;
+		/**
+		 * Legt fest, ob die ListBox automatisch zum Element scrollen soll, wenn es hinzugefügt wird.
+		 *
+		 * \param autoScrollEnabled
+		 */
+		void SetAutoScrollEnabled(bool autoScrollEnabled);
+		/**
+		 * Ruft ab, ob die ListBox automatisch zum Element scrollen soll, wenn es hinzugefügt wird.
+		 *
+		 * \return autoScrollEnabled
+		 */
+		bool GetAutoScrollEnabled() const;
+		/**
+		 * Gibt das Item an der Stelle index zurück.
+		 *
+		 * \param index
+		 * \return das Item
+		 */
+		ListItem* GetItem(int index) const;
+		/**
+		 * Ruft den Text des Items am angegebenen Index ab. Funktioniert auch im virtuellen Modus.
+		 *
+		 * \param index
+		 * \return der Text
+		 */
+		Misc::AnsiString GetItemText(int index) const;
+		/**
+		 * Schaltet den virtuellen Modus ein. Die ListBox speichert dann keine Items, sondern
+		 * fragt Anzahl und Text der sichtbaren Items bei den Providern ab. Leere Provider
+		 * schalten den virtuellen Modus wieder aus.
+		 *
+		 * \param itemCount
+		 * \param itemText
+		 */
+		void SetVirtualMode(const VirtualItemCountProvider &itemCount, const VirtualItemTextProvider &itemText);
+		/**
+		 * Ruft ab, ob sich die ListBox im virtuellen Modus befindet.
+		 *
+		 * \return ja / nein
+		 */
+		bool IsVirtualMode() const;
+		/**
+		 * Fragt im virtuellen Modus die Anzahl der Items neu ab und zeichnet die ListBox neu.
+		 */
+		void RefreshVirtualItems();
+		/**
+		 * Legt den ausgewählten Index fest.
+		 *
+		 * \param index
+		 */
+		void SetSelectedIndex(int index);
+		/**
+		 * Gibt den ausgewählten Index zurück.
+		 *
+		 * \return der ausgewählte Index
+		 */
+		int GetSelectedIndex() const;
+		/**
+		 * Legt das ausgewählte Item fest.
+		 *
+		 * \param item
+		 */
+		void SetSelectedItem(const Misc::AnsiString &item);
+		/**
+		 * Sucht das alphabetisch erste Item, dessen Text mit dem Präfix beginnt.
+		 * Die Groß-/Kleinschreibung wird nicht beachtet. Im virtuellen Modus gibt es keinen Index,
+		 * dann wird das erste passende Item in Listenreihenfolge gesucht.
+		 *
+		 * \param prefix
+		 * \return der Index des Items oder -1
+		 */
+		int FindItemByPrefix(const Misc::AnsiString &prefix) const;
+		/**
+		 * Verarbeitet ein getipptes Zeichen für die Schnellsuche und wählt das passende Item aus.
+		 * Schnell hintereinander getippte Zeichen werden zu einem Suchtext zusammengefasst,
+		 * wiederholtes Tippen desselben Zeichens springt zum nächsten passenden Item.
+		 *
+		 * \param keyChar
+		 * \return true, falls ein Item gefunden wurde
+		 */
+		bool SelectByTypeAhead(Misc::AnsiChar keyChar);
+		/**
+		 * Ruft das ausgewählte Item ab.
+		 *
+		 * \return das Item
+		 */
+		ListItem* GetSelectedItem() const;
+		/**
+		 * Gibt die Anzahl der Items zurück.
+		 *
+		 * \return Anzahl der Items
+		 */
+		int GetItemsCount() const;
+		/**
+		 * Ruft das SelectedIndexEvent für das Steuerelement ab.
+		 *
+		 * \return selectedIndexEvent
+		 */
+		SelectedIndexChangedEvent& GetSelectedIndexChangedEvent();
+		/**
+		 * Erweitert die Größe damit die angegebene Anzahl an Items sichtbar ist.
+		 */
+		void ExpandSizeToShowItems(int count);
+
+		/**
+		 * Fügt ein neues Item hinzu.
+		 *
+		 * \param text der Text des Items
+		 */
+		void AddItem(const Misc::AnsiString &text);
+		/**
+		 * Fügt ein neues Item hinzu. Die ListBox übernimmt den Besitz des Items.
+		 *
+		 * \param item
+		 */
+		void AddItem(ListItem *item);
+		/**
+		 * Fügt mehrere Items auf einmal hinzu. Das Layout wird nur einmal neu berechnet.
+		 *
+		 * \param texts
+		 */
+		void AddItems(const std::vector<Misc::AnsiString> &texts);
+		/**
+		 * Fügt mehrere Items auf einmal hinzu. Die ListBox übernimmt den Besitz der Items.
+		 *
+		 * \param items
+		 */
+		void AddItems(const std::vector<ListItem*> &items);
+		/**
+		 * Fügt ein neues Item am gewählten Index hinzu.
+		 *
+		 * \param index
+		 * \param text der Text des Items
+		 */
+		void InsertItem(int index, const Misc::AnsiString &text);
+		void InsertItem(int index, ListItem *item);
+		/**
+		 * Löscht das Item am gewählten Index.
+		 *
+		 * \param index
+		 */
+		void RemoveItem(int index);
+		/**
+		 * Übernimmt den geänderten Text des Items am gewählten Index in die Schnellsuche.
+		 *
+		 * \param index
+		 */
+		void RefreshItem(int index);
+		/**
+		 * Löscht alle Items.
+		 */
+		void Clear();
+
+		/**
+		 * Überprüft, ob sich der Punkt innerhalb des Steuerelements befindet.
+		 *
+		 * \param point
+		 * \return ja / nein
+		 */
+		virtual bool Intersect(const Drawing::PointI &point) const override;
+
+		virtual void DrawSelf(Drawing::RenderContext &context) override;
+	
+	protected:
+		virtual void PopulateGeometry() override;
+
+		virtual void OnMouseClick(const MouseMessage &mouse) override;
+		virtual void OnMouseScroll(const MouseMessage &mouse) override;
+		virtual bool OnKeyDown(const KeyboardMessage &keyboard) override;
+		virtual bool OnKeyPress(const KeyboardMessage &keyboard) override;
+
+	private:
+		static const Drawing::SizeI DefaultSize;
+		static const Drawing::SizeI DefaultItemAreaPadding;
+		static const int DefaultItemPadding;
+		static const Misc::Clock::Duration TypeAheadTimeout;
+
+		void CheckForScrollBar();
+		void OnItemsInserted(int index);
+		bool CheckVirtualMode() const;
+		int GetItemIndex(Misc::PrefixIndex::Handle handle) const;
+		/**
+		 * Sucht im virtuellen Modus ab der Startposition das erste Item, dessen Text mit dem Präfix beginnt.
+		 * Es werden nur die Texte bis zum ersten Treffer abgefragt.
+		 */
+		int FindVirtualItem(const Misc::AnsiString &prefix, int start) const;
+		
+		int selectedIndex_;
+		int firstVisibleItemIndex_;
+		int maxVisibleItems_;
+		bool autoScrollEnabled_;
+		
+		Drawing::RectangleI itemsRect_;
+		Drawing::SizeI itemAreaSize_;
+		
+		std::vector<std::unique_ptr<ListItem>> items_;
+
+		VirtualItemCountProvider virtualItemCount_;
+		VirtualItemTextProvider virtualItemText_;
+		int virtualItemsCount_;
+
+		//enthält nur die gespeicherten Items, nicht die des virtuellen Modus
+		Misc::PrefixIndex typeAheadIndex_;
+		Misc::AnsiString typeAheadText_;
+		Misc::Clock::TimePoint typeAheadTime_;
+
+		SelectedIndexChangedEvent selectedIndexChangedEvent_;
+
+		ScrollBar *scrollBar_;
+	};
+}
+
 #endif
\ No newline at end of file
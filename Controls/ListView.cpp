@@ -0,0 +1,866 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "ListView.hpp"
+#include "ScrollBar.hpp"
+#include "../Misc/Exceptions.hpp"
+#include "../Misc/Intersection.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <atomic>
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//ListView::ViewJob
+	//---------------------------------------------------------------------------
+	struct ListView::ViewJob
+	{
+		ViewJob(unsigned int generation)
+			: Generation(generation),
+			  Column(-1),
+			  Ascending(true),
+			  Cancelled(false),
+			  Done(false)
+		{
+
+		}
+
+		const unsigned int Generation;
+		std::shared_ptr<const RowList> Rows;
+		ListViewFilter Filter;
+		ListViewComparer Comparer;
+		int Column;
+		bool Ascending;
+		std::atomic<bool> Cancelled;
+		std::atomic<bool> Done;
+		std::shared_ptr<const RowView> Result;
+	};
+	namespace
+	{
+		//bricht std::stable_sort ab, sobald der Job abgebrochen wurde
+		struct ViewJobCancelled
+		{
+		};
+	}
+	//---------------------------------------------------------------------------
+	//static attributes
+	//---------------------------------------------------------------------------
+	const Drawing::SizeI ListView::DefaultSize(300, 160);
+	const int ListView::DefaultRowPadding(2);
+	const int ListView::DefaultHeaderPadding(6);
+	const int ListView::MinimumColumnWidth(12);
+	const int ListView::ColumnResizeTolerance(3);
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	ListView::ListView()
+		: rows_(std::make_shared<RowList>()),
+		  rowsGeneration_(0),
+		  viewDirty_(false),
+		  stopViewWorker_(false),
+		  sortColumn_(-1),
+		  sortAscending_(true),
+		  selectedIndex_(-1),
+		  selectedPosition_(-1),
+		  firstVisiblePosition_(0),
+		  maxVisibleRows_(1),
+		  resizeColumn_(-1),
+		  resizeStartX_(0),
+		  resizeStartWidth_(0)
+	{
+		type_ = ControlType::ListView;
+
+		scrollBar_ = new ScrollBar();
+		scrollBar_->SetVisible(false);
+		scrollBar_->GetScrollEvent() += ScrollEventHandler([this](Control*, ScrollEventArgs &args)
+		{
+			firstVisiblePosition_ = args.NewValue;
+			Invalidate();
+		});
+		scrollBar_->GetFocusLostEvent() += FocusLostEventHandler([this](Control*, Control *newFocusedControl)
+		{
+			if (newFocusedControl != this)
+			{
+				OnLostFocus(newFocusedControl);
+			}
+		});
+		AddSubControl(scrollBar_);
+
+		SetSize(DefaultSize);
+
+		ApplyStyle(Application::Instance().GetStyle());
+	}
+	//---------------------------------------------------------------------------
+	ListView::~ListView()
+	{
+		if (job_)
+		{
+			job_->Cancelled = true;
+		}
+
+		//Filter und Vergleich dürfen nach dem Destruktor nicht mehr aufgerufen werden
+		if (viewWorker_.joinable())
+		{
+			{
+				std::lock_guard<std::mutex> lock(viewWorkerMutex_);
+				stopViewWorker_ = true;
+			}
+			viewWorkerCondition_.notify_one();
+			viewWorker_.join();
+		}
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	void ListView::SetSize(const Drawing::SizeI &size)
+	{
+		Control::SetSize(size);
+
+		const auto headerHeight = GetHeaderHeight();
+		scrollBar_->SetLocation(size.Width - scrollBar_->GetWidth() - 1, headerHeight);
+		scrollBar_->SetSize(scrollBar_->GetWidth(), std::max(0, size.Height - headerHeight));
+
+		UpdateScrollBar();
+	}
+	//---------------------------------------------------------------------------
+	void ListView::SetFont(const Drawing::FontPtr &font)
+	{
+		Control::SetFont(font);
+
+		SetSize(GetSize());
+	}
+	//---------------------------------------------------------------------------
+	void ListView::AddColumn(const Misc::AnsiString &text, int width)
+	{
+		Column column = { text, std::max(MinimumColumnWidth, width) };
+		columns_.push_back(column);
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetColumnCount() const
+	{
+		return static_cast<int>(columns_.size());
+	}
+	//---------------------------------------------------------------------------
+	const Misc::AnsiString& ListView::GetColumnText(int column) const
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (column < 0 || column >= GetColumnCount())
+		{
+			throw Misc::ArgumentOutOfRangeException("column");
+		}
+		#endif
+
+		return columns_[column].Text;
+	}
+	//---------------------------------------------------------------------------
+	void ListView::SetColumnWidth(int column, int width)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (column < 0 || column >= GetColumnCount())
+		{
+			throw Misc::ArgumentOutOfRangeException("column");
+		}
+		#endif
+
+		columns_[column].Width = std::max(MinimumColumnWidth, width);
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetColumnWidth(int column) const
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (column < 0 || column >= GetColumnCount())
+		{
+			throw Misc::ArgumentOutOfRangeException("column");
+		}
+		#endif
+
+		return columns_[column].Width;
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetRowCount() const
+	{
+		return static_cast<int>(rows_->size());
+	}
+	//---------------------------------------------------------------------------
+	const ListViewRow& ListView::GetRow(int index) const
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (index < 0 || index >= GetRowCount())
+		{
+			throw Misc::ArgumentOutOfRangeException("index");
+		}
+		#endif
+
+		return (*rows_)[index];
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetVisibleRowCount() const
+	{
+		return view_ ? static_cast<int>(view_->size()) : GetRowCount();
+	}
+	//---------------------------------------------------------------------------
+	void ListView::SetSelectedIndex(int index)
+	{
+		if (selectedIndex_ == index)
+		{
+			return;
+		}
+
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (index < -1 || index >= GetRowCount())
+		{
+			throw Misc::ArgumentOutOfRangeException("index");
+		}
+		#endif
+
+		selectedIndex_ = index;
+		selectedPosition_ = FindViewPosition(index);
+
+		selectedIndexChangedEvent_.Invoke(this);
+
+		EnsureVisible(selectedPosition_);
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetSelectedIndex() const
+	{
+		return selectedIndex_;
+	}
+	//---------------------------------------------------------------------------
+	SelectedIndexChangedEvent& ListView::GetSelectedIndexChangedEvent()
+	{
+		return selectedIndexChangedEvent_;
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetSortColumn() const
+	{
+		return sortColumn_;
+	}
+	//---------------------------------------------------------------------------
+	bool ListView::GetSortAscending() const
+	{
+		return sortAscending_;
+	}
+	//---------------------------------------------------------------------------
+	void ListView::SetSortComparer(const ListViewComparer &comparer)
+	{
+		comparer_ = comparer;
+
+		if (sortColumn_ != -1)
+		{
+			InvalidateView();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ListView::SetFilter(const ListViewFilter &filter)
+	{
+		filter_ = filter;
+
+		InvalidateView();
+	}
+	//---------------------------------------------------------------------------
+	bool ListView::IsUpdatingView() const
+	{
+		return viewDirty_ || job_ != nullptr;
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetRowHeight() const
+	{
+		return static_cast<int>(GetFont()->GetFontHeight()) + DefaultRowPadding;
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetHeaderHeight() const
+	{
+		return static_cast<int>(GetFont()->GetFontHeight()) + DefaultHeaderPadding;
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	void ListView::AddRow(const ListViewRow &row)
+	{
+		GetMutableRows().push_back(row);
+
+		OnRowsChanged();
+
+		UpdateScrollBar();
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void ListView::AddRows(const std::vector<ListViewRow> &rows)
+	{
+		auto &target = GetMutableRows();
+		target.insert(std::end(target), std::begin(rows), std::end(rows));
+
+		OnRowsChanged();
+
+		UpdateScrollBar();
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void ListView::SetRows(std::vector<ListViewRow> rows)
+	{
+		rows_ = std::make_shared<RowList>(std::move(rows));
+
+		//die alte Ansicht verweist auf ungültige Indizes
+		view_ = filter_ ? std::make_shared<const RowView>() : nullptr;
+		OnRowsChanged();
+
+		selectedIndex_ = selectedPosition_ = -1;
+		selectedIndexChangedEvent_.Invoke(this);
+
+		UpdateScrollBar();
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void ListView::RemoveRow(int index)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (index < 0 || index >= GetRowCount())
+		{
+			throw Misc::ArgumentOutOfRangeException("index");
+		}
+		#endif
+
+		auto &rows = GetMutableRows();
+		rows.erase(std::begin(rows) + index);
+
+		if (view_)
+		{
+			auto view = std::make_shared<RowView>();
+			view->reserve(view_->size());
+			for (auto row : *view_)
+			{
+				if (row != index)
+				{
+					view->push_back(row > index ? row - 1 : row);
+				}
+			}
+			view_ = view;
+		}
+
+		OnRowsChanged();
+
+		if (selectedIndex_ == index)
+		{
+			selectedIndex_ = selectedPosition_ = -1;
+			selectedIndexChangedEvent_.Invoke(this);
+		}
+		else if (selectedIndex_ > index)
+		{
+			--selectedIndex_;
+			selectedPosition_ = FindViewPosition(selectedIndex_);
+		}
+
+		UpdateScrollBar();
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void ListView::ClearRows()
+	{
+		SetRows(std::vector<ListViewRow>());
+	}
+	//---------------------------------------------------------------------------
+	void ListView::Sort(int column, bool ascending)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (column < -1 || column >= GetColumnCount())
+		{
+			throw Misc::ArgumentOutOfRangeException("column");
+		}
+		#endif
+
+		sortColumn_ = column;
+		sortAscending_ = ascending;
+
+		InvalidateView();
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	ListView::RowList& ListView::GetMutableRows()
+	{
+		//ein laufender Job hält noch eine Referenz auf die alten Zeilen
+		if (rows_.use_count() > 1)
+		{
+			rows_ = std::make_shared<RowList>(*rows_);
+		}
+		return *rows_;
+	}
+	//---------------------------------------------------------------------------
+	void ListView::OnRowsChanged()
+	{
+		++rowsGeneration_;
+
+		//auch während des ersten Jobs, dessen Ergebnis die neuen Zeilen noch nicht kennt
+		if (job_ || view_ || filter_ || sortColumn_ != -1)
+		{
+			InvalidateView();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ListView::InvalidateView()
+	{
+		//mehrere Änderungen pro Frame starten nur einen Job
+		viewDirty_ = true;
+
+		ScheduleInjectTime(Misc::Clock::TimePoint());
+	}
+	//---------------------------------------------------------------------------
+	void ListView::StartViewJob()
+	{
+		viewDirty_ = false;
+
+		if (job_)
+		{
+			job_->Cancelled = true;
+			job_.reset();
+		}
+
+		if (!filter_ && sortColumn_ == -1)
+		{
+			ApplyView(nullptr);
+			return;
+		}
+
+		auto job = std::make_shared<ViewJob>(rowsGeneration_);
+		job->Rows = rows_;
+		job->Filter = filter_;
+		job->Comparer = comparer_;
+		job->Column = sortColumn_;
+		job->Ascending = sortAscending_;
+
+		{
+			//ein noch nicht begonnener Job wird ersetzt
+			std::lock_guard<std::mutex> lock(viewWorkerMutex_);
+			pendingJob_ = job;
+		}
+		if (!viewWorker_.joinable())
+		{
+			viewWorker_ = std::thread(&ListView::RunViewWorker, this);
+		}
+		viewWorkerCondition_.notify_one();
+
+		job_ = job;
+	}
+	//---------------------------------------------------------------------------
+	void ListView::RunViewWorker()
+	{
+		while (true)
+		{
+			std::shared_ptr<ViewJob> job;
+			{
+				std::unique_lock<std::mutex> lock(viewWorkerMutex_);
+				viewWorkerCondition_.wait(lock, [this] { return stopViewWorker_ || pendingJob_ != nullptr; });
+				if (stopViewWorker_)
+				{
+					return;
+				}
+				job = std::move(pendingJob_);
+			}
+
+			ComputeView(*job);
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ListView::ComputeView(ViewJob &job)
+	{
+		const auto &rows = *job.Rows;
+
+		auto view = std::make_shared<RowView>();
+		view->reserve(rows.size());
+
+		for (int i = 0, count = static_cast<int>(rows.size()); i < count; ++i)
+		{
+			if (job.Cancelled)
+			{
+				return;
+			}
+			if (!job.Filter || job.Filter(rows[i]))
+			{
+				view->push_back(i);
+			}
+		}
+
+		if (job.Column != -1)
+		{
+			const Misc::AnsiString empty;
+			const auto cell = [&](int row) -> const Misc::AnsiString&
+			{
+				const auto &cells = rows[row];
+				return job.Column < static_cast<int>(cells.size()) ? cells[job.Column] : empty;
+			};
+
+			try
+			{
+				std::stable_sort(std::begin(*view), std::end(*view), [&](int lhs, int rhs)
+				{
+					if (job.Cancelled.load(std::memory_order_relaxed))
+					{
+						throw ViewJobCancelled();
+					}
+
+					const auto &a = cell(job.Ascending ? lhs : rhs);
+					const auto &b = cell(job.Ascending ? rhs : lhs);
+					return job.Comparer ? job.Comparer(a, b) : a < b;
+				});
+			}
+			catch (const ViewJobCancelled&)
+			{
+				return;
+			}
+		}
+
+		job.Result = view;
+		job.Done.store(true, std::memory_order_release);
+	}
+	//---------------------------------------------------------------------------
+	void ListView::ApplyView(const std::shared_ptr<const RowView> &view)
+	{
+		view_ = view;
+
+		const auto oldSelectedIndex = selectedIndex_;
+		selectedPosition_ = FindViewPosition(selectedIndex_);
+		if (selectedPosition_ == -1)
+		{
+			selectedIndex_ = -1;
+		}
+
+		UpdateScrollBar();
+
+		Invalidate();
+
+		if (oldSelectedIndex != selectedIndex_)
+		{
+			selectedIndexChangedEvent_.Invoke(this);
+		}
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetViewRow(int position) const
+	{
+		return view_ ? (*view_)[position] : position;
+	}
+	//---------------------------------------------------------------------------
+	int ListView::FindViewPosition(int index) const
+	{
+		if (index < 0)
+		{
+			return -1;
+		}
+		if (!view_)
+		{
+			return index < GetRowCount() ? index : -1;
+		}
+
+		auto it = std::find(std::begin(*view_), std::end(*view_), index);
+		return it != std::end(*view_) ? static_cast<int>(it - std::begin(*view_)) : -1;
+	}
+	//---------------------------------------------------------------------------
+	void ListView::EnsureVisible(int position)
+	{
+		if (position < 0)
+		{
+			return;
+		}
+
+		if (position < firstVisiblePosition_)
+		{
+			scrollBar_->SetValue(position);
+		}
+		else if (position >= firstVisiblePosition_ + maxVisibleRows_)
+		{
+			scrollBar_->SetValue(position - maxVisibleRows_ + 1);
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ListView::UpdateScrollBar()
+	{
+		maxVisibleRows_ = std::max(1, (GetHeight() - GetHeaderHeight() - 4) / GetRowHeight());
+
+		const auto count = GetVisibleRowCount();
+		const auto maximum = std::max(0, count - maxVisibleRows_);
+
+		scrollBar_->SetVisible(maximum > 0);
+		scrollBar_->SetMaximum(maximum);
+
+		if (firstVisiblePosition_ > maximum)
+		{
+			firstVisiblePosition_ = maximum;
+		}
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetColumnAt(int x) const
+	{
+		auto left = 1;
+		for (int i = 0; i < GetColumnCount(); ++i)
+		{
+			left += columns_[i].Width;
+			if (x < left)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+	//---------------------------------------------------------------------------
+	int ListView::GetColumnBorderAt(int x) const
+	{
+		auto right = 1;
+		for (int i = 0; i < GetColumnCount(); ++i)
+		{
+			right += columns_[i].Width;
+			if (std::abs(x - right) <= ColumnResizeTolerance)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+	//---------------------------------------------------------------------------
+	void ListView::InjectTime(const Misc::Clock::TimePoint &time)
+	{
+		if (viewDirty_)
+		{
+			StartViewJob();
+		}
+
+		if (job_ && job_->Done.load(std::memory_order_acquire))
+		{
+			auto job = std::move(job_);
+
+			//die Zeilen wurden seit dem Start geändert, die Indizes des Ergebnisses stimmen nicht mehr
+			if (job->Generation == rowsGeneration_)
+			{
+				ApplyView(job->Result);
+			}
+			else
+			{
+				InvalidateView();
+			}
+		}
+
+		if (job_)
+		{
+			//im nächsten Frame erneut prüfen
+			ScheduleInjectTime(time + Misc::Clock::Duration(1));
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ListView::DrawSelf(Drawing::RenderContext &context)
+	{
+		Control::DrawSelf(context);
+
+		scrollBar_->Render();
+	}
+	//---------------------------------------------------------------------------
+	void ListView::PopulateGeometry()
+	{
+		using namespace Drawing;
+
+		Graphics g(*geometry_);
+
+		g.FillRectangle(GetBackColor(), PointF(1, 1), GetSize() - SizeF(2, 2));
+
+		const auto borderColor = GetBackColor() + Color::FromARGB(0, 54, 53, 52);
+		g.FillRectangle(borderColor, PointF(1, 0), SizeF(GetWidth() - 2, 1));
+		g.FillRectangle(borderColor, PointF(0, 1), SizeF(1, GetHeight() - 2));
+		g.FillRectangle(borderColor, PointF(GetWidth() - 1, 1), SizeF(1, GetHeight() - 2));
+		g.FillRectangle(borderColor, PointF(1, GetHeight() - 1), SizeF(GetWidth() - 2, 1));
+
+		const auto headerHeight = GetHeaderHeight();
+		const auto rowHeight = GetRowHeight();
+		const auto contentWidth = GetWidth() - 2 - (scrollBar_->GetVisible() ? scrollBar_->GetWidth() : 0);
+		const RectangleF contentClip(1, 1, contentWidth, GetHeight() - 2);
+
+		g.FillRectangle(GetBackColor() + Color::FromARGB(0, 32, 32, 32), PointF(1, 1), SizeF(GetWidth() - 2, headerHeight - 1));
+		g.FillRectangle(borderColor, PointF(1, headerHeight), SizeF(GetWidth() - 2, 1));
+
+		auto left = 1;
+		for (int i = 0; i < GetColumnCount() && left < contentWidth; ++i)
+		{
+			const auto &column = columns_[i];
+			const auto clip = RectangleF(left, 1, std::min(column.Width - 4, contentWidth - left), headerHeight - 1).GetIntersection(contentClip);
+
+			g.DrawString(column.Text, GetFont(), GetForeColor(), PointF(left + 3, DefaultHeaderPadding / 2), clip);
+
+			if (i == sortColumn_)
+			{
+				const auto x = left + column.Width - 10.0f;
+				const auto y = headerHeight / 2.0f;
+				if (sortAscending_)
+				{
+					g.FillTriangle(GetForeColor(), PointF(x, y + 2), PointF(x + 6, y + 2), PointF(x + 3, y - 2));
+				}
+				else
+				{
+					g.FillTriangle(GetForeColor(), PointF(x, y - 2), PointF(x + 6, y - 2), PointF(x + 3, y + 2));
+				}
+			}
+
+			left += column.Width;
+			g.FillRectangle(borderColor, PointF(left, 1), SizeF(1, GetHeight() - 2));
+		}
+
+		const auto count = GetVisibleRowCount();
+		const auto top = headerHeight + 3;
+		for (int i = 0; i < maxVisibleRows_ && firstVisiblePosition_ + i < count; ++i)
+		{
+			const auto position = firstVisiblePosition_ + i;
+			const auto &row = (*rows_)[GetViewRow(position)];
+			const auto y = top + i * rowHeight;
+
+			if (position == selectedPosition_)
+			{
+				g.FillRectangle(Color::Red(), PointF(1, y - 1), SizeF(contentWidth, rowHeight));
+			}
+
+			left = 1;
+			for (int j = 0; j < GetColumnCount() && left < contentWidth; ++j)
+			{
+				if (j < static_cast<int>(row.size()) && !row[j].empty())
+				{
+					const auto clip = RectangleF(left, y - 1, std::min(columns_[j].Width - 4, contentWidth - left), rowHeight).GetIntersection(contentClip);
+
+					g.DrawString(row[j], GetFont(), GetForeColor(), PointF(left + 3, y), clip);
+				}
+
+				left += columns_[j].Width;
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	//Event-Handling
+	//---------------------------------------------------------------------------
+	void ListView::OnMouseDown(const MouseMessage &mouse)
+	{
+		Control::OnMouseDown(mouse);
+
+		const auto location = mouse.GetLocation() - absoluteLocation_;
+		if (location.Y < GetHeaderHeight())
+		{
+			const auto column = GetColumnBorderAt(location.X);
+			if (column != -1)
+			{
+				resizeColumn_ = column;
+				resizeStartX_ = location.X;
+				resizeStartWidth_ = columns_[column].Width;
+
+				OnGotMouseCapture();
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ListView::OnMouseMove(const MouseMessage &mouse)
+	{
+		Control::OnMouseMove(mouse);
+
+		if (resizeColumn_ != -1)
+		{
+			const auto location = mouse.GetLocation() - absoluteLocation_;
+
+			SetColumnWidth(resizeColumn_, resizeStartWidth_ + location.X - resizeStartX_);
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ListView::OnMouseUp(const MouseMessage &mouse)
+	{
+		Control::OnMouseUp(mouse);
+
+		if (resizeColumn_ != -1)
+		{
+			resizeColumn_ = -1;
+
+			OnLostMouseCapture();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ListView::OnMouseClick(const MouseMessage &mouse)
+	{
+		Control::OnMouseClick(mouse);
+
+		const auto location = mouse.GetLocation() - absoluteLocation_;
+		if (location.Y < GetHeaderHeight())
+		{
+			const auto column = GetColumnAt(location.X);
+			if (column != -1)
+			{
+				Sort(column, column == sortColumn_ ? !sortAscending_ : true);
+			}
+		}
+		else
+		{
+			const auto position = firstVisiblePosition_ + (location.Y - GetHeaderHeight() - 2) / GetRowHeight();
+			if (position >= 0 && position < GetVisibleRowCount())
+			{
+				SetSelectedIndex(GetViewRow(position));
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ListView::OnMouseScroll(const MouseMessage &mouse)
+	{
+		Control::OnMouseScroll(mouse);
+
+		scrollBar_->SetValue(scrollBar_->GetValue() + mouse.GetDelta());
+	}
+	//---------------------------------------------------------------------------
+	bool ListView::OnKeyDown(const KeyboardMessage &keyboard)
+	{
+		if (!Control::OnKeyDown(keyboard))
+		{
+			const auto count = GetVisibleRowCount();
+			if (count == 0)
+			{
+				return false;
+			}
+
+			auto position = selectedPosition_;
+			switch (keyboard.GetKeyCode())
+			{
+				case Key::Up:
+					--position;
+					break;
+				case Key::Down:
+					++position;
+					break;
+				case Key::Home:
+					position = 0;
+					break;
+				case Key::End:
+					position = count - 1;
+					break;
+				case Key::PageUp:
+					position -= maxVisibleRows_;
+					break;
+				case Key::PageDown:
+					position += maxVisibleRows_;
+					break;
+				default:
+					return false;
+			}
+
+			position = std::max(0, std::min(position, count - 1));
+
+			SetSelectedIndex(GetViewRow(position));
+
+			return true;
+		}
+
+		return false;
+	}
+	//---------------------------------------------------------------------------
+}
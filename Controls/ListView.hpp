@@ -0,0 +1,291 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_LISTVIEW_HPP
+#define OSHGUI_LISTVIEW_HPP
+
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "Control.hpp"
+#include "ListBox.hpp"
+
+namespace OSHGui
+{
+	class ScrollBar;
+
+	/**
+	 * Eine Zeile der ListView, ein Text pro Spalte.
+	 */
+	typedef std::vector<Misc::AnsiString> ListViewRow;
+	/**
+	 * Entscheidet, ob eine Zeile angezeigt wird. Wird in einem Hintergrund-Thread aufgerufen.
+	 */
+	typedef std::function<bool(const ListViewRow &row)> ListViewFilter;
+	/**
+	 * Vergleicht zwei Zellen beim Sortieren. Wird in einem Hintergrund-Thread aufgerufen.
+	 */
+	typedef std::function<bool(const Misc::AnsiString &lhs, const Misc::AnsiString &rhs)> ListViewComparer;
+
+	/**
+	 * Stellt eine Tabelle mit Spaltenköpfen dar. Es werden nur die sichtbaren Zeilen gezeichnet,
+	 * Sortieren und Filtern laufen in einem Hintergrund-Thread.
+	 */
+	class OSHGUI_EXPORT ListView : public Control
+	{
+	public:
+		using Control::SetSize;
+
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		ListView();
+		virtual ~ListView();
+
+		/**
+		 * Legt die Höhe und Breite des Steuerelements fest.
+		 *
+		 * \param size
+		 */
+		virtual void SetSize(const Drawing::SizeI &size) override;
+		/**
+		 * Legt die Schriftart des Texts im Steuerelement fest.
+		 *
+		 * \param font
+		 */
+		virtual void SetFont(const Drawing::FontPtr &font) override;
+
+		/**
+		 * Fügt eine Spalte hinzu.
+		 *
+		 * \param text der Spaltenkopf
+		 * \param width die Breite der Spalte
+		 */
+		void AddColumn(const Misc::AnsiString &text, int width);
+		/**
+		 * Ruft die Anzahl der Spalten ab.
+		 *
+		 * \return Anzahl der Spalten
+		 */
+		int GetColumnCount() const;
+		/**
+		 * Ruft den Spaltenkopf ab.
+		 *
+		 * \param column
+		 * \return text
+		 */
+		const Misc::AnsiString& GetColumnText(int column) const;
+		/**
+		 * Legt die Breite der Spalte fest.
+		 *
+		 * \param column
+		 * \param width
+		 */
+		void SetColumnWidth(int column, int width);
+		/**
+		 * Ruft die Breite der Spalte ab.
+		 *
+		 * \param column
+		 * \return width
+		 */
+		int GetColumnWidth(int column) const;
+
+		/**
+		 * Fügt eine Zeile hinzu.
+		 *
+		 * \param row
+		 */
+		void AddRow(const ListViewRow &row);
+		/**
+		 * Fügt mehrere Zeilen auf einmal hinzu.
+		 *
+		 * \param rows
+		 */
+		void AddRows(const std::vector<ListViewRow> &rows);
+		/**
+		 * Ersetzt alle Zeilen.
+		 *
+		 * \param rows
+		 */
+		void SetRows(std::vector<ListViewRow> rows);
+		/**
+		 * Löscht die Zeile am angegebenen Index.
+		 *
+		 * \param index
+		 */
+		void RemoveRow(int index);
+		/**
+		 * Löscht alle Zeilen.
+		 */
+		void ClearRows();
+		/**
+		 * Ruft die Anzahl aller Zeilen ab.
+		 *
+		 * \return Anzahl der Zeilen
+		 */
+		int GetRowCount() const;
+		/**
+		 * Ruft die Zeile am angegebenen Index ab.
+		 *
+		 * \param index
+		 * \return row
+		 */
+		const ListViewRow& GetRow(int index) const;
+		/**
+		 * Ruft die Anzahl der Zeilen ab, die nach dem Filtern angezeigt werden.
+		 *
+		 * \return Anzahl der angezeigten Zeilen
+		 */
+		int GetVisibleRowCount() const;
+
+		/**
+		 * Legt den Index der ausgewählten Zeile fest.
+		 *
+		 * \param index -1 hebt die Auswahl auf
+		 */
+		void SetSelectedIndex(int index);
+		/**
+		 * Ruft den Index der ausgewählten Zeile ab.
+		 *
+		 * \return index oder -1
+		 */
+		int GetSelectedIndex() const;
+		/**
+		 * Ruft das SelectedIndexChangedEvent für das Steuerelement ab.
+		 *
+		 * \return selectedIndexChangedEvent
+		 */
+		SelectedIndexChangedEvent& GetSelectedIndexChangedEvent();
+
+		/**
+		 * Sortiert die Zeilen nach der angegebenen Spalte.
+		 *
+		 * \param column -1 stellt die ursprüngliche Reihenfolge wieder her
+		 * \param ascending
+		 */
+		void Sort(int column, bool ascending = true);
+		/**
+		 * Ruft die Spalte ab, nach der sortiert wird.
+		 *
+		 * \return column oder -1
+		 */
+		int GetSortColumn() const;
+		/**
+		 * Ruft ab, ob aufsteigend sortiert wird.
+		 *
+		 * \return ascending
+		 */
+		bool GetSortAscending() const;
+		/**
+		 * Legt die Vergleichsfunktion zum Sortieren fest. Standard ist der Textvergleich.
+		 *
+		 * \param comparer
+		 */
+		void SetSortComparer(const ListViewComparer &comparer);
+		/**
+		 * Legt den Filter fest. Ein leerer Filter zeigt alle Zeilen an.
+		 *
+		 * \param filter
+		 */
+		void SetFilter(const ListViewFilter &filter);
+		/**
+		 * Ruft ab, ob gerade im Hintergrund sortiert oder gefiltert wird.
+		 *
+		 * \return ja / nein
+		 */
+		bool IsUpdatingView() const;
+
+		virtual void DrawSelf(Drawing::RenderContext &context) override;
+
+	protected:
+		virtual void InjectTime(const Misc::Clock::TimePoint &time) override;
+
+		virtual void PopulateGeometry() override;
+
+		virtual void OnMouseDown(const MouseMessage &mouse) override;
+		virtual void OnMouseMove(const MouseMessage &mouse) override;
+		virtual void OnMouseUp(const MouseMessage &mouse) override;
+		virtual void OnMouseClick(const MouseMessage &mouse) override;
+		virtual void OnMouseScroll(const MouseMessage &mouse) override;
+		virtual bool OnKeyDown(const KeyboardMessage &keyboard) override;
+
+	private:
+		static const Drawing::SizeI DefaultSize;
+		static const int DefaultRowPadding;
+		static const int DefaultHeaderPadding;
+		static const int MinimumColumnWidth;
+		static const int ColumnResizeTolerance;
+
+		struct Column
+		{
+			Misc::AnsiString Text;
+			int Width;
+		};
+		struct ViewJob;
+
+		typedef std::vector<ListViewRow> RowList;
+		typedef std::vector<int> RowView;
+
+		RowList& GetMutableRows();
+		/**
+		 * Verwirft laufende Jobs, deren Zeilenindizes nicht mehr stimmen, und berechnet die Ansicht bei Bedarf neu.
+		 */
+		void OnRowsChanged();
+		void InvalidateView();
+		void StartViewJob();
+		void RunViewWorker();
+		static void ComputeView(ViewJob &job);
+		void ApplyView(const std::shared_ptr<const RowView> &view);
+		int GetViewRow(int position) const;
+		int FindViewPosition(int index) const;
+		void EnsureVisible(int position);
+		void UpdateScrollBar();
+		int GetRowHeight() const;
+		int GetHeaderHeight() const;
+		int GetColumnAt(int x) const;
+		int GetColumnBorderAt(int x) const;
+
+		std::vector<Column> columns_;
+
+		std::shared_ptr<RowList> rows_;
+		std::shared_ptr<const RowView> view_;
+		std::shared_ptr<ViewJob> job_;
+		//wird bei jeder Änderung der Zeilen erhöht, ältere Jobs werden verworfen
+		unsigned int rowsGeneration_;
+		bool viewDirty_;
+
+		//ein einziger Thread berechnet die Ansichten nacheinander, der Destruktor wartet auf ihn
+		std::thread viewWorker_;
+		std::mutex viewWorkerMutex_;
+		std::condition_variable viewWorkerCondition_;
+		std::shared_ptr<ViewJob> pendingJob_;
+		bool stopViewWorker_;
+
+		ListViewFilter filter_;
+		ListViewComparer comparer_;
+		int sortColumn_;
+		bool sortAscending_;
+
+		int selectedIndex_;
+		int selectedPosition_;
+		int firstVisiblePosition_;
+		int maxVisibleRows_;
+
+		int resizeColumn_;
+		int resizeStartX_;
+		int resizeStartWidth_;
+
+		SelectedIndexChangedEvent selectedIndexChangedEvent_;
+
+		ScrollBar *scrollBar_;
+	};
+}
+
+#endif
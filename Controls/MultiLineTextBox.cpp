@@ -0,0 +1,592 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "MultiLineTextBox.hpp"
+#include "ScrollBar.hpp"
+#include "../Misc/Exceptions.hpp"
+#include <algorithm>
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//static attributes
+	//---------------------------------------------------------------------------
+	const Drawing::SizeI MultiLineTextBox::DefaultSize(200, 120);
+	const Drawing::PointI MultiLineTextBox::DefaultTextOffset(7, 5);
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	MultiLineTextBox::MultiLineTextBox()
+		: showCaret_(true),
+		  drawCaret_(false),
+		  blinkTime_(std::chrono::milliseconds(500)),
+		  caretLine_(0),
+		  caretColumn_(0),
+		  desiredCaretX_(0.0f),
+		  firstVisibleLine_(0),
+		  maxVisibleLines_(1),
+		  scrollX_(0.0f)
+	{
+		type_ = ControlType::MultiLineTextBox;
+
+		lines_.Insert(0, Line());
+
+		scrollBar_ = new ScrollBar();
+		scrollBar_->SetVisible(false);
+		scrollBar_->GetScrollEvent() += ScrollEventHandler([this](Control*, ScrollEventArgs &args)
+		{
+			firstVisibleLine_ = args.NewValue;
+			Invalidate();
+		});
+		scrollBar_->GetFocusLostEvent() += FocusLostEventHandler([this](Control*, Control *newFocusedControl)
+		{
+			if (newFocusedControl != this)
+			{
+				OnLostFocus(newFocusedControl);
+			}
+		});
+		AddSubControl(scrollBar_);
+
+		ApplyStyle(Application::Instance().GetStyle());
+
+		SetSize(DefaultSize);
+
+		cursor_ = Cursors::Get(Cursors::IBeam);
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::SetSize(const Drawing::SizeI &size)
+	{
+		Control::SetSize(size);
+
+		scrollBar_->SetLocation(size.Width - scrollBar_->GetWidth() - 1, 0);
+		scrollBar_->SetSize(scrollBar_->GetWidth(), size.Height);
+
+		UpdateScrollBar();
+
+		MoveCaret(caretLine_, caretColumn_);
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::SetFont(const Drawing::FontPtr &font)
+	{
+		Control::SetFont(font);
+
+		//alle Messungen hängen von der Schriftart ab
+		for (std::size_t i = 0; i < lines_.GetSize(); ++i)
+		{
+			InvalidateLine(static_cast<int>(i));
+		}
+
+		UpdateScrollBar();
+
+		MoveCaret(caretLine_, caretColumn_);
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::SetText(const Misc::AnsiString &text)
+	{
+		lines_.Clear();
+
+		Line line;
+		for (auto c : text)
+		{
+			if (c == '\n')
+			{
+				lines_.Insert(lines_.GetSize(), std::move(line));
+				line = Line();
+			}
+			else if (c != '\r')
+			{
+				line.Text += c;
+			}
+		}
+		lines_.Insert(lines_.GetSize(), std::move(line));
+
+		scrollX_ = 0.0f;
+		caretLine_ = caretColumn_ = 0;
+
+		UpdateScrollBar();
+		scrollBar_->SetValue(0);
+
+		MoveCaret(0, 0);
+
+		OnTextChanged();
+	}
+	//---------------------------------------------------------------------------
+	Misc::AnsiString MultiLineTextBox::GetText() const
+	{
+		std::size_t length = lines_.GetSize() - 1;
+		for (std::size_t i = 0; i < lines_.GetSize(); ++i)
+		{
+			length += lines_[i].Text.length();
+		}
+
+		Misc::AnsiString text;
+		text.reserve(length);
+		for (std::size_t i = 0; i < lines_.GetSize(); ++i)
+		{
+			if (i != 0)
+			{
+				text += '\n';
+			}
+			text += lines_[i].Text;
+		}
+		return text;
+	}
+	//---------------------------------------------------------------------------
+	int MultiLineTextBox::GetLineCount() const
+	{
+		return static_cast<int>(lines_.GetSize());
+	}
+	//---------------------------------------------------------------------------
+	const Misc::AnsiString& MultiLineTextBox::GetLine(int line) const
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (line < 0 || line >= GetLineCount())
+		{
+			throw Misc::ArgumentOutOfRangeException("line");
+		}
+		#endif
+
+		return lines_[line].Text;
+	}
+	//---------------------------------------------------------------------------
+	int MultiLineTextBox::GetCaretLine() const
+	{
+		return caretLine_;
+	}
+	//---------------------------------------------------------------------------
+	int MultiLineTextBox::GetCaretColumn() const
+	{
+		return caretColumn_;
+	}
+	//---------------------------------------------------------------------------
+	TextChangedEvent& MultiLineTextBox::GetTextChangedEvent()
+	{
+		return textChangedEvent_;
+	}
+	//---------------------------------------------------------------------------
+	int MultiLineTextBox::GetLineHeight() const
+	{
+		return std::max(1, static_cast<int>(GetFont()->GetFontHeight()));
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::ShowCaret(bool showCaret)
+	{
+		showCaret_ = showCaret;
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::SetCaretPosition(int line, int column)
+	{
+		MoveCaret(line, column);
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::InsertText(const Misc::AnsiString &text)
+	{
+		if (text.empty())
+		{
+			return;
+		}
+
+		auto &current = lines_[caretLine_];
+		const auto tail = current.Text.substr(caretColumn_);
+		current.Text.erase(caretColumn_);
+		InvalidateLine(caretLine_);
+
+		auto line = caretLine_;
+		for (auto c : text)
+		{
+			if (c == '\n')
+			{
+				lines_.Insert(++line, Line());
+			}
+			else if (c != '\r')
+			{
+				lines_[line].Text += c;
+			}
+		}
+
+		auto &last = lines_[line];
+		const auto column = static_cast<int>(last.Text.length());
+		last.Text += tail;
+		InvalidateLine(line);
+
+		if (line != caretLine_)
+		{
+			UpdateScrollBar();
+		}
+
+		MoveCaret(line, column);
+
+		OnTextChanged();
+	}
+	//---------------------------------------------------------------------------
+	const std::vector<float>& MultiLineTextBox::GetAdvances(int line) const
+	{
+		auto &entry = lines_[line];
+		if (entry.Advances.empty())
+		{
+			const auto &font = GetFont();
+
+			entry.Advances.reserve(entry.Text.length() + 1);
+
+			auto advance = 0.0f;
+			entry.Advances.push_back(advance);
+			for (auto c : entry.Text)
+			{
+				if (const auto glyph = font->GetGlyphData(static_cast<unsigned char>(c)))
+				{
+					advance += glyph->GetAdvance();
+				}
+				entry.Advances.push_back(advance);
+			}
+		}
+		return entry.Advances;
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::InvalidateLine(int line)
+	{
+		auto &advances = lines_[line].Advances;
+		advances.clear();
+		advances.shrink_to_fit();
+	}
+	//---------------------------------------------------------------------------
+	int MultiLineTextBox::GetColumnAtPixel(int line, float x) const
+	{
+		const auto &advances = GetAdvances(line);
+
+		const auto it = std::upper_bound(std::begin(advances), std::end(advances), x);
+		if (it == std::begin(advances))
+		{
+			return 0;
+		}
+		if (it == std::end(advances))
+		{
+			return static_cast<int>(advances.size()) - 1;
+		}
+
+		const auto column = static_cast<int>(it - std::begin(advances));
+		return x - advances[column - 1] < advances[column] - x ? column - 1 : column;
+	}
+	//---------------------------------------------------------------------------
+	bool MultiLineTextBox::RemoveBackward()
+	{
+		if (caretColumn_ > 0)
+		{
+			lines_[caretLine_].Text.erase(caretColumn_ - 1, 1);
+			InvalidateLine(caretLine_);
+
+			MoveCaret(caretLine_, caretColumn_ - 1);
+
+			return true;
+		}
+		if (caretLine_ > 0)
+		{
+			auto &previous = lines_[caretLine_ - 1];
+			const auto column = static_cast<int>(previous.Text.length());
+			previous.Text += lines_[caretLine_].Text;
+			InvalidateLine(caretLine_ - 1);
+
+			lines_.Erase(caretLine_);
+
+			UpdateScrollBar();
+
+			MoveCaret(caretLine_ - 1, column);
+
+			return true;
+		}
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	bool MultiLineTextBox::RemoveForward()
+	{
+		auto &current = lines_[caretLine_];
+		if (caretColumn_ < static_cast<int>(current.Text.length()))
+		{
+			current.Text.erase(caretColumn_, 1);
+			InvalidateLine(caretLine_);
+
+			MoveCaret(caretLine_, caretColumn_);
+
+			return true;
+		}
+		if (caretLine_ + 1 < GetLineCount())
+		{
+			current.Text += lines_[caretLine_ + 1].Text;
+			InvalidateLine(caretLine_);
+
+			lines_.Erase(caretLine_ + 1);
+
+			UpdateScrollBar();
+
+			MoveCaret(caretLine_, caretColumn_);
+
+			return true;
+		}
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::MoveCaret(int line, int column, bool keepDesiredX)
+	{
+		caretLine_ = std::max(0, std::min(line, GetLineCount() - 1));
+		caretColumn_ = std::max(0, std::min(column, static_cast<int>(lines_[caretLine_].Text.length())));
+
+		if (!keepDesiredX)
+		{
+			desiredCaretX_ = GetAdvances(caretLine_)[caretColumn_];
+		}
+
+		EnsureCaretVisible();
+
+		ResetCaretBlink();
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::EnsureCaretVisible()
+	{
+		if (caretLine_ < firstVisibleLine_)
+		{
+			scrollBar_->SetValue(caretLine_);
+		}
+		else if (caretLine_ >= firstVisibleLine_ + maxVisibleLines_)
+		{
+			scrollBar_->SetValue(caretLine_ - maxVisibleLines_ + 1);
+		}
+
+		const auto caretX = GetAdvances(caretLine_)[caretColumn_];
+		const auto width = static_cast<float>(textRect_.GetWidth());
+		if (caretX < scrollX_)
+		{
+			scrollX_ = std::max(0.0f, caretX - width / 4);
+		}
+		else if (caretX >= scrollX_ + width)
+		{
+			scrollX_ = caretX - width + width / 4;
+		}
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::UpdateScrollBar()
+	{
+		const auto height = GetHeight() - DefaultTextOffset.Top * 2;
+
+		maxVisibleLines_ = std::max(1, height / GetLineHeight());
+
+		const auto maximum = std::max(0, GetLineCount() - maxVisibleLines_);
+		scrollBar_->SetVisible(maximum > 0);
+		scrollBar_->SetMaximum(maximum);
+
+		textRect_ = Drawing::RectangleI(DefaultTextOffset.Left, DefaultTextOffset.Top, GetWidth() - DefaultTextOffset.Left * 2 - (maximum > 0 ? scrollBar_->GetWidth() : 0), height);
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::ResetCaretBlink()
+	{
+		drawCaret_ = false;
+
+		if (isFocused_)
+		{
+			ScheduleInjectTime(Misc::Clock::TimePoint());
+		}
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::InjectTime(const Misc::Clock::TimePoint &time)
+	{
+		drawCaret_ = !drawCaret_;
+		ScheduleInjectTime(time + blinkTime_);
+
+		Invalidate();
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::DrawSelf(Drawing::RenderContext &context)
+	{
+		Control::DrawSelf(context);
+
+		scrollBar_->Render();
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::PopulateGeometry()
+	{
+		using namespace Drawing;
+
+		Graphics g(*geometry_);
+
+		g.FillRectangle(GetBackColor() - Color::FromARGB(0, 20, 20, 20), PointF(0, 0), GetSize());
+		g.FillRectangle(GetBackColor(), PointF(1, 1), GetSize() - SizeF(2, 2));
+
+		const RectangleF clip(textRect_.GetLeft(), textRect_.GetTop(), textRect_.GetWidth(), textRect_.GetHeight());
+		const auto lineHeight = GetLineHeight();
+		const auto right = scrollX_ + textRect_.GetWidth();
+
+		for (int i = 0; i < maxVisibleLines_ && firstVisibleLine_ + i < GetLineCount(); ++i)
+		{
+			const auto line = firstVisibleLine_ + i;
+			const auto &text = lines_[line].Text;
+			if (text.empty())
+			{
+				continue;
+			}
+
+			//nur die Zeichen zeichnen, die horizontal im sichtbaren Bereich liegen
+			const auto &advances = GetAdvances(line);
+			const auto first = std::max(0, static_cast<int>(std::upper_bound(std::begin(advances), std::end(advances), scrollX_) - std::begin(advances)) - 1);
+			const auto last = std::min(static_cast<int>(text.length()), static_cast<int>(std::lower_bound(std::begin(advances), std::end(advances), right) - std::begin(advances)));
+			if (first >= last)
+			{
+				continue;
+			}
+
+			const PointF origin(textRect_.GetLeft() + advances[first] - scrollX_, textRect_.GetTop() + i * lineHeight);
+			g.DrawString(text.substr(first, last - first), GetFont(), GetForeColor(), origin, clip);
+		}
+
+		if (showCaret_ && isFocused_ && drawCaret_)
+		{
+			const auto row = caretLine_ - firstVisibleLine_;
+			if (row >= 0 && row < maxVisibleLines_)
+			{
+				const auto x = textRect_.GetLeft() + GetAdvances(caretLine_)[caretColumn_] - scrollX_;
+				g.FillRectangle(GetForeColor(), PointF(x, textRect_.GetTop() + row * lineHeight), SizeF(1, lineHeight));
+			}
+		}
+	}
+	//---------------------------------------------------------------------------
+	//Event-Handling
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::OnMouseDown(const MouseMessage &mouse)
+	{
+		Control::OnMouseDown(mouse);
+
+		const auto location = mouse.GetLocation() - absoluteLocation_;
+
+		const auto line = std::max(0, std::min(firstVisibleLine_ + (location.Y - textRect_.GetTop()) / GetLineHeight(), GetLineCount() - 1));
+		MoveCaret(line, GetColumnAtPixel(line, location.X - textRect_.GetLeft() + scrollX_));
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::OnMouseScroll(const MouseMessage &mouse)
+	{
+		Control::OnMouseScroll(mouse);
+
+		scrollBar_->SetValue(scrollBar_->GetValue() + mouse.GetDelta());
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::OnGotFocus(Control *newFocusedControl)
+	{
+		Control::OnGotFocus(newFocusedControl);
+
+		ResetCaretBlink();
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::OnLostFocus(Control *newFocusedControl)
+	{
+		Control::OnLostFocus(newFocusedControl);
+
+		CancelInjectTime();
+		drawCaret_ = false;
+	}
+	//---------------------------------------------------------------------------
+	bool MultiLineTextBox::OnKeyDown(const KeyboardMessage &keyboard)
+	{
+		Control::OnKeyDown(keyboard);
+
+		switch (keyboard.GetKeyCode())
+		{
+			case Key::Delete:
+				if (RemoveForward())
+				{
+					OnTextChanged();
+				}
+				break;
+			case Key::Back:
+				if (RemoveBackward())
+				{
+					OnTextChanged();
+				}
+				break;
+			case Key::Return:
+				InsertText("\n");
+				break;
+			case Key::Left:
+				if (caretColumn_ == 0 && caretLine_ > 0)
+				{
+					MoveCaret(caretLine_ - 1, static_cast<int>(lines_[caretLine_ - 1].Text.length()));
+				}
+				else
+				{
+					MoveCaret(caretLine_, caretColumn_ - 1);
+				}
+				break;
+			case Key::Right:
+				if (caretColumn_ == static_cast<int>(lines_[caretLine_].Text.length()) && caretLine_ + 1 < GetLineCount())
+				{
+					MoveCaret(caretLine_ + 1, 0);
+				}
+				else
+				{
+					MoveCaret(caretLine_, caretColumn_ + 1);
+				}
+				break;
+			case Key::Up:
+			case Key::Down:
+			case Key::PageUp:
+			case Key::PageDown:
+			{
+				auto line = caretLine_;
+				switch (keyboard.GetKeyCode())
+				{
+					case Key::Up:
+						--line;
+						break;
+					case Key::Down:
+						++line;
+						break;
+					case Key::PageUp:
+						line -= maxVisibleLines_;
+						break;
+					case Key::PageDown:
+						line += maxVisibleLines_;
+						break;
+				}
+				line = std::max(0, std::min(line, GetLineCount() - 1));
+
+				MoveCaret(line, GetColumnAtPixel(line, desiredCaretX_), true);
+				break;
+			}
+			case Key::Home:
+				MoveCaret(caretLine_, 0);
+				break;
+			case Key::End:
+				MoveCaret(caretLine_, static_cast<int>(lines_[caretLine_].Text.length()));
+				break;
+		}
+
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	bool MultiLineTextBox::OnKeyPress(const KeyboardMessage &keyboard)
+	{
+		if (!Control::OnKeyPress(keyboard))
+		{
+			if (keyboard.GetKeyCode() != Key::Return && keyboard.IsAlphaNumeric())
+			{
+				InsertText(Misc::AnsiString(1, keyboard.GetKeyChar()));
+			}
+		}
+
+		return true;
+	}
+	//---------------------------------------------------------------------------
+	void MultiLineTextBox::OnTextChanged()
+	{
+		textChangedEvent_.Invoke(this);
+	}
+	//---------------------------------------------------------------------------
+}
@@ -0,0 +1,174 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_MULTILINETEXTBOX_HPP
+#define OSHGUI_MULTILINETEXTBOX_HPP
+
+#include <vector>
+#include "Control.hpp"
+#include "TextBox.hpp"
+#include "../Misc/GapBuffer.hpp"
+
+namespace OSHGui
+{
+	class ScrollBar;
+
+	/**
+	 * Stellt ein mehrzeiliges Textfeld dar. Die Zeilen liegen in einem GapBuffer, die Breiten
+	 * der Zeichen werden pro Zeile zwischengespeichert und nur für bearbeitete Zeilen neu berechnet.
+	 */
+	class OSHGUI_EXPORT MultiLineTextBox : public Control
+	{
+	public:
+		using Control::SetSize;
+
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		MultiLineTextBox();
+
+		/**
+		 * Legt die Höhe und Breite des Steuerelements fest.
+		 *
+		 * \param size
+		 */
+		virtual void SetSize(const Drawing::SizeI &size) override;
+		/**
+		 * Legt die Schriftart des Texts im Steuerelement fest.
+		 *
+		 * \param font
+		 */
+		virtual void SetFont(const Drawing::FontPtr &font) override;
+		/**
+		 * Legt den Text fest. Zeilen werden durch '\n' getrennt.
+		 *
+		 * \param text
+		 */
+		void SetText(const Misc::AnsiString &text);
+		/**
+		 * Ruft den Text ab. Zeilen werden durch '\n' getrennt.
+		 *
+		 * \return der Text
+		 */
+		Misc::AnsiString GetText() const;
+		/**
+		 * Ruft die Anzahl der Zeilen ab.
+		 *
+		 * \return Anzahl der Zeilen
+		 */
+		int GetLineCount() const;
+		/**
+		 * Ruft den Text der angegebenen Zeile ab.
+		 *
+		 * \param line
+		 * \return der Text
+		 */
+		const Misc::AnsiString& GetLine(int line) const;
+		/**
+		 * Ruft die Zeile ab, in der sich der Cursor befindet.
+		 *
+		 * \return line
+		 */
+		int GetCaretLine() const;
+		/**
+		 * Ruft die Spalte ab, in der sich der Cursor befindet.
+		 *
+		 * \return column
+		 */
+		int GetCaretColumn() const;
+		/**
+		 * Ruft das TextChangedEvent für das Steuerelement ab.
+		 *
+		 * \return textChangedEvent
+		 */
+		TextChangedEvent& GetTextChangedEvent();
+
+		/**
+		 * Legt fest, ob der Cursor angezeigt wird.
+		 *
+		 * \param showCaret
+		 */
+		void ShowCaret(bool showCaret);
+		/**
+		 * Setzt den Cursor an die angegebene Position.
+		 *
+		 * \param line
+		 * \param column
+		 */
+		void SetCaretPosition(int line, int column);
+		/**
+		 * Fügt Text an der Cursorposition ein. Zeilen werden durch '\n' getrennt.
+		 *
+		 * \param text
+		 */
+		void InsertText(const Misc::AnsiString &text);
+
+		virtual void DrawSelf(Drawing::RenderContext &context) override;
+
+	protected:
+		virtual void InjectTime(const Misc::Clock::TimePoint &time) override;
+
+		virtual void PopulateGeometry() override;
+
+		virtual void OnMouseDown(const MouseMessage &mouse) override;
+		virtual void OnMouseScroll(const MouseMessage &mouse) override;
+		virtual void OnGotFocus(Control *newFocusedControl) override;
+		virtual void OnLostFocus(Control *newFocusedControl) override;
+		virtual bool OnKeyPress(const KeyboardMessage &keyboard) override;
+		virtual bool OnKeyDown(const KeyboardMessage &keyboard) override;
+		virtual void OnTextChanged();
+
+	private:
+		static const Drawing::SizeI DefaultSize;
+		static const Drawing::PointI DefaultTextOffset;
+
+		struct Line
+		{
+			Misc::AnsiString Text;
+			/**
+			 * Advances[i] ist die Breite der ersten i Zeichen. Leer, solange die Zeile nicht vermessen wurde.
+			 */
+			std::vector<float> Advances;
+		};
+
+		const std::vector<float>& GetAdvances(int line) const;
+		void InvalidateLine(int line);
+		int GetColumnAtPixel(int line, float x) const;
+
+		bool RemoveBackward();
+		bool RemoveForward();
+
+		void MoveCaret(int line, int column, bool keepDesiredX = false);
+		void EnsureCaretVisible();
+		void UpdateScrollBar();
+		void ResetCaretBlink();
+		int GetLineHeight() const;
+
+		mutable Misc::GapBuffer<Line> lines_;
+
+		Drawing::RectangleI textRect_;
+
+		bool showCaret_;
+		bool drawCaret_;
+		Misc::Clock::Duration blinkTime_;
+
+		int caretLine_;
+		int caretColumn_;
+		float desiredCaretX_;
+
+		int firstVisibleLine_;
+		int maxVisibleLines_;
+		float scrollX_;
+
+		TextChangedEvent textChangedEvent_;
+
+		ScrollBar *scrollBar_;
+	};
+}
+
+#endif
@@ -0,0 +1,225 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "ScrollPanel.hpp"
+#include "ScrollBar.hpp"
+#include "../Misc/Exceptions.hpp"
+#include <algorithm>
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//static attributes
+	//---------------------------------------------------------------------------
+	const Drawing::SizeI ScrollPanel::DefaultSize(200, 200);
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	ScrollPanel::ScrollPanel()
+		: scrollOffset_(0),
+		  contentHeight_(0)
+	{
+		type_ = ControlType::ScrollPanel;
+
+		contentLayout_ = std::make_shared<ContentLayout>(*this);
+
+		containerPanel_ = new ContentPanel();
+		containerPanel_->SetLocation(Drawing::PointI(0, 0));
+		containerPanel_->SetBackColor(Drawing::Color::Empty());
+		containerPanel_->SetLayoutEngine(contentLayout_);
+		AddSubControl(containerPanel_);
+
+		scrollBar_ = new ScrollBar();
+		scrollBar_->GetScrollEvent() += ScrollEventHandler([this](Control*, ScrollEventArgs &args)
+		{
+			//SetScrollOffset hat die ScrollBar selbst verschoben
+			if (args.NewValue != (scrollOffset_ + ScrollStep - 1) / ScrollStep)
+			{
+				SetScrollOffset(args.NewValue * ScrollStep);
+			}
+		});
+		AddSubControl(scrollBar_);
+
+		SetSize(DefaultSize);
+
+		ApplyStyle(Application::Instance().GetStyle());
+
+		isFocusable_ = true;
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	void ScrollPanel::SetSize(const Drawing::SizeI &size)
+	{
+		Control::SetSize(size);
+
+		scrollBar_->SetLocation(size.Width - scrollBar_->GetWidth(), 0);
+		scrollBar_->SetSize(scrollBar_->GetWidth(), size.Height);
+
+		containerPanel_->SetSize(std::max(0, size.Width - scrollBar_->GetWidth()), size.Height);
+
+		UpdateScrollRange();
+	}
+	//---------------------------------------------------------------------------
+	void ScrollPanel::SetScrollOffset(int offset)
+	{
+		offset = std::max(0, std::min(offset, GetMaximumScrollOffset()));
+		if (offset == scrollOffset_)
+		{
+			return;
+		}
+
+		scrollOffset_ = offset;
+
+		//nur eine Translation, der Inhalt wird nicht neu aufgebaut
+		containerPanel_->SetLocation(Drawing::PointI(0, -offset));
+
+		scrollBar_->SetValue((offset + ScrollStep - 1) / ScrollStep);
+	}
+	//---------------------------------------------------------------------------
+	int ScrollPanel::GetScrollOffset() const
+	{
+		return scrollOffset_;
+	}
+	//---------------------------------------------------------------------------
+	int ScrollPanel::GetMaximumScrollOffset() const
+	{
+		return std::max(0, contentHeight_ - GetHeight());
+	}
+	//---------------------------------------------------------------------------
+	const ControlList& ScrollPanel::GetControls() const
+	{
+		return containerPanel_->GetControls();
+	}
+	//---------------------------------------------------------------------------
+	void ScrollPanel::SetLayoutEngine(const std::shared_ptr<LayoutEngine> &layoutEngine)
+	{
+		contentLayout_->SetLayoutEngine(layoutEngine);
+
+		containerPanel_->InvalidateLayout();
+	}
+	//---------------------------------------------------------------------------
+	LayoutEngine& ScrollPanel::GetLayoutEngine() const
+	{
+		return contentLayout_->GetLayoutEngine();
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	void ScrollPanel::AddControl(Control *control)
+	{
+		containerPanel_->AddControl(control);
+
+		UpdateScrollRange();
+	}
+	//---------------------------------------------------------------------------
+	void ScrollPanel::RemoveControl(Control *control)
+	{
+		containerPanel_->RemoveControl(control);
+
+		UpdateScrollRange();
+	}
+	//---------------------------------------------------------------------------
+	void ScrollPanel::ScrollIntoView(const Control *control)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (control == nullptr)
+		{
+			throw Misc::ArgumentNullException("control");
+		}
+		#endif
+
+		if (control->GetTop() < scrollOffset_)
+		{
+			SetScrollOffset(control->GetTop());
+		}
+		else if (control->GetBottom() > scrollOffset_ + GetHeight())
+		{
+			SetScrollOffset(control->GetBottom() - GetHeight());
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ScrollPanel::UpdateScrollRange()
+	{
+		contentHeight_ = 0;
+		for (auto &control : containerPanel_->GetControls())
+		{
+			if (control->GetVisible())
+			{
+				contentHeight_ = std::max(contentHeight_, control->GetBottom());
+			}
+		}
+
+		const auto maximum = GetMaximumScrollOffset();
+		scrollBar_->SetMaximum((maximum + ScrollStep - 1) / ScrollStep);
+
+		if (scrollOffset_ > maximum)
+		{
+			SetScrollOffset(maximum);
+		}
+	}
+	//---------------------------------------------------------------------------
+	void ScrollPanel::DrawSelf(Drawing::RenderContext &context)
+	{
+		Control::DrawSelf(context);
+
+		containerPanel_->Render();
+		scrollBar_->Render();
+	}
+	//---------------------------------------------------------------------------
+	//Event-Handling
+	//---------------------------------------------------------------------------
+	void ScrollPanel::OnMouseScroll(const MouseMessage &mouse)
+	{
+		Control::OnMouseScroll(mouse);
+
+		SetScrollOffset(scrollOffset_ + mouse.GetDelta() * ScrollStep);
+	}
+	//---------------------------------------------------------------------------
+	//ScrollPanel::ContentLayout
+	//---------------------------------------------------------------------------
+	ScrollPanel::ContentLayout::ContentLayout(ScrollPanel &owner)
+		: owner_(owner)
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	void ScrollPanel::ContentLayout::SetLayoutEngine(const std::shared_ptr<LayoutEngine> &layoutEngine)
+	{
+		layoutEngine_ = layoutEngine;
+	}
+	//---------------------------------------------------------------------------
+	LayoutEngine& ScrollPanel::ContentLayout::GetLayoutEngine() const
+	{
+		return layoutEngine_ ? *layoutEngine_ : DefaultLayout::Instance();
+	}
+	//---------------------------------------------------------------------------
+	Drawing::SizeI ScrollPanel::ContentLayout::Measure(const Control &container) const
+	{
+		return GetLayoutEngine().Measure(container);
+	}
+	//---------------------------------------------------------------------------
+	void ScrollPanel::ContentLayout::Layout(Control &container)
+	{
+		GetLayoutEngine().Layout(container);
+
+		//Steuerelemente wurden verschoben, vergrößert oder ein- und ausgeblendet
+		owner_.UpdateScrollRange();
+	}
+	//---------------------------------------------------------------------------
+	//ScrollPanel::ContentPanel
+	//---------------------------------------------------------------------------
+	Drawing::RectangleI ScrollPanel::ContentPanel::GetChildClip(const Control &/*child*/) const
+	{
+		//der sichtbare Bereich beginnt um die Scrollposition oberhalb des Inhalts
+		const auto viewport = Drawing::RectangleI(absoluteLocation_.X, absoluteLocation_.Y - location_.Y, GetWidth(), GetParent()->GetHeight());
+
+		return clip_.GetIntersection(viewport);
+	}
+	//---------------------------------------------------------------------------
+}
@@ -0,0 +1,148 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_SCROLLPANEL_HPP
+#define OSHGUI_SCROLLPANEL_HPP
+
+#include "Panel.hpp"
+#include "LayoutEngine.hpp"
+
+namespace OSHGui
+{
+	class ScrollBar;
+
+	/**
+	 * Ein Panel, dessen Inhalt senkrecht gescrollt werden kann. Beim Scrollen wird nur
+	 * der Inhalt verschoben, die Geometrie der Steuerelemente bleibt unverändert. Der Inhalt
+	 * wird auf den sichtbaren Bereich beschnitten.
+	 */
+	class OSHGUI_EXPORT ScrollPanel : public Panel
+	{
+	public:
+		using Panel::SetSize;
+
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		ScrollPanel();
+
+		/**
+		 * Legt die Höhe und Breite des Steuerelements fest.
+		 *
+		 * \param size
+		 */
+		virtual void SetSize(const Drawing::SizeI &size) override;
+		/**
+		 * Legt fest, wie weit der Inhalt gescrollt ist.
+		 *
+		 * \param offset in Pixeln, wird auf 0 bis GetMaximumScrollOffset() begrenzt
+		 */
+		void SetScrollOffset(int offset);
+		/**
+		 * Ruft ab, wie weit der Inhalt gescrollt ist.
+		 *
+		 * \return offset in Pixeln
+		 */
+		int GetScrollOffset() const;
+		/**
+		 * Ruft ab, wie weit der Inhalt höchstens gescrollt werden kann.
+		 *
+		 * \return offset in Pixeln
+		 */
+		int GetMaximumScrollOffset() const;
+		/**
+		 * Gibt eine Liste der untergeordneten Steuerelemente zurück.
+		 *
+		 * \return parent
+		 */
+		virtual const ControlList& GetControls() const override;
+		/**
+		 * Legt fest, wie die untergeordneten Steuerelemente angeordnet werden.
+		 *
+		 * \param layoutEngine
+		 */
+		virtual void SetLayoutEngine(const std::shared_ptr<LayoutEngine> &layoutEngine) override;
+		/**
+		 * Ruft ab, wie die untergeordneten Steuerelemente angeordnet werden.
+		 *
+		 * \return layoutEngine
+		 */
+		virtual LayoutEngine& GetLayoutEngine() const override;
+
+		/**
+		 * Fügt ein untergeordnetes Steuerelement hinzu.
+		 *
+		 * \param control
+		 */
+		virtual void AddControl(Control *control) override;
+		/**
+		 * Entfernt ein untergeordnetes Steuerelement.
+		 *
+		 * \param control
+		 */
+		virtual void RemoveControl(Control *control) override;
+		/**
+		 * Scrollt so weit, dass das Steuerelement vollständig sichtbar ist.
+		 *
+		 * \param control
+		 */
+		void ScrollIntoView(const Control *control);
+
+		virtual void DrawSelf(Drawing::RenderContext &context) override;
+
+	protected:
+		virtual void OnMouseScroll(const MouseMessage &mouse) override;
+
+	private:
+		static const Drawing::SizeI DefaultSize;
+		static const int ScrollStep = 16;
+
+		/**
+		 * Übernimmt die Höhe des Inhalts in die ScrollBar.
+		 */
+		void UpdateScrollRange();
+
+		/**
+		 * Nimmt den Inhalt auf. Er ist höher als der sichtbare Bereich und wird deshalb nicht
+		 * auf die eigene Größe, sondern auf die des ScrollPanel beschnitten.
+		 */
+		class ContentPanel : public Panel
+		{
+		protected:
+			virtual Drawing::RectangleI GetChildClip(const Control &child) const override;
+		};
+
+		/**
+		 * Ordnet den Inhalt mit der gewählten LayoutEngine an und aktualisiert danach den Scrollbereich.
+		 */
+		class ContentLayout : public LayoutEngine
+		{
+		public:
+			ContentLayout(ScrollPanel &owner);
+
+			void SetLayoutEngine(const std::shared_ptr<LayoutEngine> &layoutEngine);
+			LayoutEngine& GetLayoutEngine() const;
+
+			virtual Drawing::SizeI Measure(const Control &container) const override;
+			virtual void Layout(Control &container) override;
+
+		private:
+			ScrollPanel &owner_;
+			std::shared_ptr<LayoutEngine> layoutEngine_;
+		};
+
+		int scrollOffset_;
+		int contentHeight_;
+
+		Panel *containerPanel_;
+		ScrollBar *scrollBar_;
+		std::shared_ptr<ContentLayout> contentLayout_;
+	};
+}
+
+#endif
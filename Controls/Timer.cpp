@@ -1,86 +1,96 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#include "Timer.hpp"
-#include "../Misc/Exceptions.hpp"
-
-namespace OSHGui
-{
-	//---------------------------------------------------------------------------
-	//Constructor
-	//---------------------------------------------------------------------------
-	Timer::Timer()
-		: interval_(Misc::TimeSpan::FromMilliseconds(100))
-	{
-		type_ = ControlType::Timer;
-	
-		SetEnabled(false);
-	}
-	//---------------------------------------------------------------------------
-	//Getter/Setter
-	//---------------------------------------------------------------------------
-	void Timer::SetEnabled(bool isEnabled)
-	{
-		if (isEnabled_ != isEnabled)
-		{
-			next_ = Misc::DateTime();
-			
-			Control::SetEnabled(isEnabled);
-		}
-	}
-	//---------------------------------------------------------------------------
-	void Timer::SetInterval(int interval)
-	{
-		#ifndef OSHGUI_DONTUSEEXCEPTIONS
-		if (interval < 1)
-		{
-			throw Misc::ArgumentOutOfRangeException("interval");
-		}
-		#endif
-		
-		interval_ = Misc::TimeSpan::FromMilliseconds(interval);
-	}
-	//---------------------------------------------------------------------------
-	int Timer::GetInterval() const
-	{
-		return interval_.GetTotalMilliseconds();
-	}
-	//---------------------------------------------------------------------------
-	TickEvent& Timer::GetTickEvent()
-	{
-		return tickEvent_;
-	}
-	//---------------------------------------------------------------------------
-	//Runtime-Functions
-	//---------------------------------------------------------------------------
-	void Timer::Start()
-	{
-		SetEnabled(true);
-	}
-	//---------------------------------------------------------------------------
-	void Timer::Stop()
-	{
-		SetEnabled(false);
-	}
-	//---------------------------------------------------------------------------
-	bool Timer::Intersect(const Drawing::PointI &point) const
-	{
-		return false;
-	}
-	//---------------------------------------------------------------------------
-	void Timer::InjectTime(const Misc::DateTime &time)
-	{
-		if (time >= next_)
-		{
-			next_ = time.Add(interval_);
-			
-			tickEvent_.Invoke(this);
-		}
-	}
-	//---------------------------------------------------------------------------
-}
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Timer.hpp"
+#include "../Misc/Exceptions.hpp"
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	Timer::Timer()
+		: interval_(std::chrono::milliseconds(100))
+	{
+		type_ = ControlType::Timer;
+	
+		SetEnabled(false);
+	}
+	//---------------------------------------------------------------------------
+	//Getter/Setter
+	//---------------------------------------------------------------------------
+	void Timer::SetEnabled(bool isEnabled)
+	{
+		if (isEnabled_ != isEnabled)
+		{
+			if (isEnabled)
+			{
+				ScheduleInjectTime(Misc::Clock::TimePoint());
+			}
+			else
+			{
+				CancelInjectTime();
+			}
+			
+			Control::SetEnabled(isEnabled);
+		}
+	}
+	//---------------------------------------------------------------------------
+	void Timer::SetInterval(int interval)
+	{
+		#ifndef OSHGUI_DONTUSEEXCEPTIONS
+		if (interval < 1)
+		{
+			throw Misc::ArgumentOutOfRangeException("interval");
+		}
+		#endif
+		
+		interval_ = std::chrono::milliseconds(interval);
+	}
+	//---------------------------------------------------------------------------
+	int Timer::GetInterval() const
+	{
+		return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(interval_).count());
+	}
+	//---------------------------------------------------------------------------
+	TickEvent& Timer::GetTickEvent()
+	{
+		return tickEvent_;
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	void Timer::Start()
+	{
+		SetEnabled(true);
+	}
+	//---------------------------------------------------------------------------
+	void Timer::Stop()
+	{
+		SetEnabled(false);
+	}
+	//---------------------------------------------------------------------------
+	bool Timer::Intersect(const Drawing::PointI &point) const
+	{
+		return false;
+	}
+	//---------------------------------------------------------------------------
+	void Timer::InjectTime(const Misc::Clock::TimePoint &time)
+	{
+		ScheduleInjectTime(time + interval_);
+
+		//nur Timer in angezeigten Forms lösen aus, der Zeitplan läuft aber weiter
+		if (!IsInShownForm())
+		{
+			return;
+		}
+		
+		tickEvent_.Invoke(this);
+	}
+	//---------------------------------------------------------------------------
+}
@@ -1,26 +1,26 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_CURSOR_PEN_HPP
-#define OSHGUI_CURSOR_PEN_HPP
-
-#include "Cursor.hpp"
-
-namespace OSHGui
-{
-	/**
-	 * Stift-Cursor
-	 */
-	class PenCursor : public Cursor
-	{
-	protected:
-		virtual void Initialize() override;
-	};
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_CURSOR_PEN_HPP
+#define OSHGUI_CURSOR_PEN_HPP
+
+#include "Cursor.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Stift-Cursor
+	 */
+	class PenCursor : public Cursor
+	{
+	protected:
+		virtual void Initialize() override;
+	};
+}
+
 #endif
\ No newline at end of file
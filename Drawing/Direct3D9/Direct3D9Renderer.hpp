@@ -1,132 +1,154 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_DRAWING_DIRECT3D9RENDERER_HPP
-#define OSHGUI_DRAWING_DIRECT3D9RENDERER_HPP
-
-#include "../Renderer.hpp"
-
-#include <d3d9.h>
-#include <vector>
-#include <map>
-
-namespace OSHGui
-{
-	namespace Drawing
-	{
-		class Direct3D9Texture;
-		class Direct3D9TextureTarget;
-		class Direct3D9GeometryBuffer;
-
-		/**
-		 * Die Direct3D9 Variante des Renderer.
-		 */
-		class OSHGUI_EXPORT Direct3D9Renderer : public Renderer
-		{
-		public:
-			/**
-			 * Konstruktor der Klasse.
-			 *
-			 * \param device Direct3D9 Device
-			 */
-			Direct3D9Renderer(LPDIRECT3DDEVICE9 device);
-			virtual ~Direct3D9Renderer();
-
-			/**
-			 * Hilfsfunktion, die vor einem D3D Reset aufgerufen werden muss.
-			 */
-			void PreD3DReset();
-			/**
-			 * Hilfsfunktion, die nach einem D3D Reset aufgerufen werden muss.
-			 */
-			void PostD3DReset();
-
-			/**
-			 * Ruft das Direct3D9 Device ab.
-			 */
-			LPDIRECT3DDEVICE9 GetDevice() const;
-
-			/**
-			 * Prft, ob nicht-quadratische Texturgren untersttzt werden.
-			 */
-			bool SupportsNonSquareTexture();
-
-			/**
-			 * Prft, ob nicht-2^x Texturgren untersttzt werden.
-			 */
-			bool SupportsNPOTTextures();
-
-			/**
-			 * Rechnet die Gre in eine untersttzt Gre um.
-			 *
-			 * \param size
-			 * \return umgewandelte Gre
-			 * \sa SupportsNonSquareTexture(), SupportsNPOTTextures()
-			 */
-			SizeF GetAdjustedSize(const SizeF &size);
-
-			virtual RenderTargetPtr& GetDefaultRenderTarget() override;
-			virtual GeometryBufferPtr CreateGeometryBuffer() override;
-			virtual TextureTargetPtr CreateTextureTarget() override;
-			virtual TexturePtr CreateTexture() override;
-			virtual TexturePtr CreateTexture(const Misc::AnsiString &filename) override;
-			virtual TexturePtr CreateTexture(const SizeF &size) override;
-
-			virtual void BeginRendering() override;
-			virtual void EndRendering() override;
-			virtual void SetDisplaySize(const SizeF &sz) override;
-			virtual const SizeF& GetDisplaySize() const override;
-			virtual const PointF& GetDisplayDPI() const override;
-			virtual uint32_t GetMaximumTextureSize() const override;
-
-		protected:
-			void RegisterTexture(const std::shared_ptr<Direct3D9Texture> &texture);
-
-		private:
-			/**
-			 * Ruft die Gre des Viewport ab.
-			 *
-			 * \return Gre des Viewport
-			 */
-			SizeF GetViewportSize();
-			/**
-			 * Berechnet die nchste Zweierpotenz, falss \a size keine Zweierpotenz ist.
-			 *
-			 * \param size
-			 * \return nchste Zweierpotenz
-			 */
-			float GetSizeNextPOT(float size) const;
-
-			/**
-			 * Entfernt ungltige Referenzen zu Objekten, fr die ein Reset ausgefhrt werden muss.
-			 */
-			void RemoveWeakReferences();
-
-			LPDIRECT3DDEVICE9 device;
-			
-			SizeF displaySize;
-			PointF displayDPI;
-			
-			RenderTargetPtr defaultTarget;
-			
-			typedef std::vector<std::weak_ptr<Direct3D9TextureTarget>> TextureTargetList;
-			TextureTargetList textureTargets;
-			
-			typedef std::vector<std::weak_ptr<Direct3D9Texture>> TextureList;
-			TextureList textures;
-			
-			uint32_t maxTextureSize;
-			bool supportNPOTTex;
-			bool supportNonSquareTex;
-
-			IDirect3DStateBlock9 *stateBlock;
-		};
-	}
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_DRAWING_DIRECT3D9RENDERER_HPP
+#define OSHGUI_DRAWING_DIRECT3D9RENDERER_HPP
+
+#include "../Renderer.hpp"
+
+#include <d3d9.h>
+#include <vector>
+#include <map>
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		class Direct3D9Texture;
+		class Direct3D9TextureTarget;
+		class Direct3D9GeometryBuffer;
+
+		/**
+		 * Die Direct3D9 Variante des Renderer.
+		 */
+		class OSHGUI_EXPORT Direct3D9Renderer : public Renderer
+		{
+		public:
+			/**
+			 * Konstruktor der Klasse.
+			 *
+			 * \param device Direct3D9 Device
+			 */
+			Direct3D9Renderer(LPDIRECT3DDEVICE9 device);
+			virtual ~Direct3D9Renderer();
+
+			/**
+			 * Hilfsfunktion, die vor einem D3D Reset aufgerufen werden muss.
+			 */
+			void PreD3DReset();
+			/**
+			 * Hilfsfunktion, die nach einem D3D Reset aufgerufen werden muss.
+			 */
+			void PostD3DReset();
+
+			/**
+			 * Ruft das Direct3D9 Device ab.
+			 */
+			LPDIRECT3DDEVICE9 GetDevice() const;
+
+			/**
+			 * Prüft, ob nicht-quadratische Texturgrößen unterstützt werden.
+			 */
+			bool SupportsNonSquareTexture();
+
+			/**
+			 * Prüft, ob nicht-2^x Texturgrößen unterstützt werden.
+			 */
+			bool SupportsNPOTTextures();
+
+			/**
+			 * Rechnet die Größe in eine unterstützt Größe um.
+			 *
+			 * \param size
+			 * \return umgewandelte Größe
+			 * \sa SupportsNonSquareTexture(), SupportsNPOTTextures()
+			 */
+			SizeF GetAdjustedSize(const SizeF &size);
+
+			/**
+			 * Setzt das Scissor-Rechteck, falls es sich vom zuletzt gesetzten unterscheidet. Aufeinanderfolgende
+			 * GeometryBuffer mit derselben Clipping Region ändern den Zustand des Device so nur einmal.
+			 *
+			 * \param clip die Clipping Region oder nullptr für den gesamten aktiven RenderTarget
+			 */
+			void SetScissorRect(const RectangleF *clip);
+			/**
+			 * Muss aufgerufen werden, nachdem das Device das Scissor-Rechteck selbst zurückgesetzt hat (SetRenderTarget).
+			 */
+			void InvalidateScissorRect();
+			/**
+			 * Legt den RenderTarget fest, dessen Bereich SetScissorRect(nullptr) verwendet.
+			 *
+			 * \param target der aktive RenderTarget oder nullptr für den Standard-RenderTarget
+			 */
+			void SetActiveRenderTarget(const RenderTarget *target);
+
+			virtual RenderTargetPtr& GetDefaultRenderTarget() override;
+			virtual GeometryBufferPtr CreateGeometryBuffer() override;
+			virtual TextureTargetPtr CreateTextureTarget() override;
+			virtual TexturePtr CreateTexture() override;
+			virtual TexturePtr CreateTexture(const Misc::AnsiString &filename) override;
+			virtual TexturePtr CreateTexture(const SizeF &size) override;
+
+			virtual void BeginRendering() override;
+			virtual void EndRendering() override;
+			virtual void SetDisplaySize(const SizeF &sz) override;
+			virtual const SizeF& GetDisplaySize() const override;
+			virtual const PointF& GetDisplayDPI() const override;
+			virtual uint32_t GetMaximumTextureSize() const override;
+
+		protected:
+			void RegisterTexture(const std::shared_ptr<Direct3D9Texture> &texture);
+
+		private:
+			/**
+			 * Ruft die Größe des Viewport ab.
+			 *
+			 * \return Größe des Viewport
+			 */
+			SizeF GetViewportSize();
+			/**
+			 * Berechnet die nächste Zweierpotenz, falss \a size keine Zweierpotenz ist.
+			 *
+			 * \param size
+			 * \return nächste Zweierpotenz
+			 */
+			float GetSizeNextPOT(float size) const;
+
+			/**
+			 * Entfernt ungültige Referenzen zu Objekten, für die ein Reset ausgeführt werden muss.
+			 */
+			void RemoveWeakReferences();
+
+			LPDIRECT3DDEVICE9 device;
+			
+			SizeF displaySize;
+			PointF displayDPI;
+			
+			RenderTargetPtr defaultTarget;
+			const RenderTarget *activeTarget;
+			
+			typedef std::vector<std::weak_ptr<Direct3D9TextureTarget>> TextureTargetList;
+			TextureTargetList textureTargets;
+			
+			typedef std::vector<std::weak_ptr<Direct3D9Texture>> TextureList;
+			TextureList textures;
+			
+			uint32_t maxTextureSize;
+			bool supportNPOTTex;
+			bool supportNonSquareTex;
+
+			IDirect3DStateBlock9 *stateBlock;
+
+			RECT scissorRect;
+			bool scissorRectValid;
+		};
+	}
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,591 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "FontLocator.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_TRUETYPE_TABLES_H
+
+//FT_SFNT_OS2 ersetzt ft_sfnt_os2 erst ab FreeType 2.6
+#if FREETYPE_MAJOR == 2 && FREETYPE_MINOR < 6
+#define FT_SFNT_OS2 ft_sfnt_os2
+#endif
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		//---------------------------------------------------------------------------
+		//static attributes
+		//---------------------------------------------------------------------------
+		bool FontLocator::initialised = false;
+		bool FontLocator::cacheFileSet = false;
+		Misc::AnsiString FontLocator::cacheFile;
+		std::vector<Misc::AnsiString> FontLocator::extraDirectories;
+		std::vector<FontLocator::DirectoryInfo> FontLocator::directories;
+		std::vector<FontLocator::FontEntry> FontLocator::fonts;
+		std::unordered_map<Misc::AnsiString, size_t> FontLocator::nameIndex;
+		std::unordered_map<Misc::AnsiString, std::vector<size_t>> FontLocator::familyIndex;
+		//---------------------------------------------------------------------------
+		namespace
+		{
+			const char CacheHeader[] = "OSHGuiFontCache 2";
+
+			#ifdef _WIN32
+			const char PathSeparator = '\\';
+			#else
+			const char PathSeparator = '/';
+			#endif
+			//---------------------------------------------------------------------------
+			Misc::AnsiString NormaliseName(const Misc::AnsiString &name)
+			{
+				auto lower(name);
+				std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+
+				Misc::AnsiString result;
+				std::stringstream ss(lower);
+				for (Misc::AnsiString part; ss >> part;)
+				{
+					if (!result.empty())
+					{
+						result += ' ';
+					}
+					result += part;
+				}
+				return result;
+			}
+			//---------------------------------------------------------------------------
+			bool IsRegularStyle(const Misc::AnsiString &style)
+			{
+				const auto normalised = NormaliseName(style);
+				return normalised.empty() || normalised == "regular" || normalised == "normal" || normalised == "book" || normalised == "roman";
+			}
+			//---------------------------------------------------------------------------
+			bool IsFontFile(const Misc::AnsiString &filename)
+			{
+				const auto dot = filename.find_last_of('.');
+				if (dot == Misc::AnsiString::npos)
+				{
+					return false;
+				}
+
+				auto extension = filename.substr(dot + 1);
+				std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+				return extension == "ttf" || extension == "otf" || extension == "ttc" || extension == "otc";
+			}
+			//---------------------------------------------------------------------------
+			long long GetModificationTime(const Misc::AnsiString &path)
+			{
+				#ifdef _WIN32
+				struct _stat64 info;
+				if (_stat64(path.c_str(), &info) != 0)
+				#else
+				struct stat info;
+				if (stat(path.c_str(), &info) != 0)
+				#endif
+				{
+					return -1;
+				}
+				return static_cast<long long>(info.st_mtime);
+			}
+			//---------------------------------------------------------------------------
+			void ListDirectory(const Misc::AnsiString &directory, std::vector<Misc::AnsiString> &files, std::vector<Misc::AnsiString> &subdirectories)
+			{
+				#ifdef _WIN32
+				WIN32_FIND_DATAA data;
+				const auto find = FindFirstFileA((directory + "\\*").c_str(), &data);
+				if (find == INVALID_HANDLE_VALUE)
+				{
+					return;
+				}
+
+				do
+				{
+					const Misc::AnsiString name(data.cFileName);
+					if (name == "." || name == "..")
+					{
+						continue;
+					}
+
+					if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+					{
+						if (!(data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+						{
+							subdirectories.push_back(directory + PathSeparator + name);
+						}
+					}
+					else
+					{
+						files.push_back(directory + PathSeparator + name);
+					}
+				} while (FindNextFileA(find, &data));
+
+				FindClose(find);
+				#else
+				const auto dir = opendir(directory.c_str());
+				if (dir == nullptr)
+				{
+					return;
+				}
+
+				while (const auto entry = readdir(dir))
+				{
+					const Misc::AnsiString name(entry->d_name);
+					if (name == "." || name == "..")
+					{
+						continue;
+					}
+
+					const auto path = directory + PathSeparator + name;
+
+					//symlinked directories are skipped to avoid cycles
+					struct stat info;
+					if (lstat(path.c_str(), &info) != 0)
+					{
+						continue;
+					}
+					if (S_ISDIR(info.st_mode))
+					{
+						subdirectories.push_back(path);
+					}
+					else if (S_ISREG(info.st_mode) || (S_ISLNK(info.st_mode) && stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode)))
+					{
+						files.push_back(path);
+					}
+				}
+
+				closedir(dir);
+				#endif
+
+				std::sort(files.begin(), files.end());
+				std::sort(subdirectories.begin(), subdirectories.end());
+			}
+			//---------------------------------------------------------------------------
+			Misc::AnsiString GetEnvironment(const char *name)
+			{
+				#ifdef _WIN32
+				char buffer[MAX_PATH] = { };
+				const auto length = GetEnvironmentVariableA(name, buffer, sizeof(buffer));
+				return length > 0 && length < sizeof(buffer) ? Misc::AnsiString(buffer) : Misc::AnsiString();
+				#else
+				const auto value = std::getenv(name);
+				return value ? Misc::AnsiString(value) : Misc::AnsiString();
+				#endif
+			}
+		}
+		//---------------------------------------------------------------------------
+		//Getter/Setter
+		//---------------------------------------------------------------------------
+		const std::vector<FontLocator::FontEntry>& FontLocator::GetFonts()
+		{
+			EnsureIndex();
+
+			return fonts;
+		}
+		//---------------------------------------------------------------------------
+		void FontLocator::AddFontDirectory(const Misc::AnsiString &directory)
+		{
+			if (std::find(extraDirectories.begin(), extraDirectories.end(), directory) != extraDirectories.end())
+			{
+				return;
+			}
+
+			extraDirectories.push_back(directory);
+
+			Invalidate();
+		}
+		//---------------------------------------------------------------------------
+		void FontLocator::SetCacheFile(const Misc::AnsiString &file)
+		{
+			cacheFile = file;
+			cacheFileSet = true;
+		}
+		//---------------------------------------------------------------------------
+		std::vector<Misc::AnsiString> FontLocator::GetDefaultDirectories()
+		{
+			std::vector<Misc::AnsiString> result;
+
+			#if defined(_WIN32)
+			const auto windir = GetEnvironment("windir");
+			if (!windir.empty())
+			{
+				result.push_back(windir + "\\Fonts");
+			}
+			const auto localAppData = GetEnvironment("LOCALAPPDATA");
+			if (!localAppData.empty())
+			{
+				result.push_back(localAppData + "\\Microsoft\\Windows\\Fonts");
+			}
+			#elif defined(__APPLE__)
+			result.push_back("/System/Library/Fonts");
+			result.push_back("/Library/Fonts");
+			const auto home = GetEnvironment("HOME");
+			if (!home.empty())
+			{
+				result.push_back(home + "/Library/Fonts");
+			}
+			#else
+			result.push_back("/usr/share/fonts");
+			result.push_back("/usr/local/share/fonts");
+			const auto home = GetEnvironment("HOME");
+			if (!home.empty())
+			{
+				result.push_back(home + "/.fonts");
+			}
+			const auto dataHome = GetEnvironment("XDG_DATA_HOME");
+			if (!dataHome.empty())
+			{
+				result.push_back(dataHome + "/fonts");
+			}
+			else if (!home.empty())
+			{
+				result.push_back(home + "/.local/share/fonts");
+			}
+			#endif
+
+			result.insert(result.end(), extraDirectories.begin(), extraDirectories.end());
+
+			return result;
+		}
+		//---------------------------------------------------------------------------
+		Misc::AnsiString FontLocator::GetDefaultCacheFile()
+		{
+			#ifdef _WIN32
+			const auto temp = GetEnvironment("TEMP");
+			return temp.empty() ? Misc::AnsiString() : temp + "\\OSHGui.fontcache";
+			#else
+			const auto cacheHome = GetEnvironment("XDG_CACHE_HOME");
+			if (!cacheHome.empty())
+			{
+				return cacheHome + "/OSHGui.fontcache";
+			}
+			const auto home = GetEnvironment("HOME");
+			return home.empty() ? Misc::AnsiString() : home + "/.cache/OSHGui.fontcache";
+			#endif
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		const FontLocator::FontEntry* FontLocator::FindFont(const Misc::AnsiString &name)
+		{
+			EnsureIndex();
+
+			const auto key = NormaliseName(name);
+			if (key.empty())
+			{
+				return nullptr;
+			}
+
+			const auto it = nameIndex.find(key);
+			if (it != nameIndex.end())
+			{
+				return &fonts[it->second];
+			}
+
+			//allow a different word order ("Bold Arial")
+			std::vector<Misc::AnsiString> parts;
+			std::stringstream ss(key);
+			for (Misc::AnsiString s; ss >> s; parts.push_back(s));
+
+			//bei mehreren Treffern entscheidet der Name, nicht die Reihenfolge der Hashtabelle
+			const std::pair<const Misc::AnsiString, size_t> *best = nullptr;
+			for (auto &entry : nameIndex)
+			{
+				if (entry.first.length() != key.length() || (best != nullptr && entry.first >= best->first))
+				{
+					continue;
+				}
+
+				auto foundAll = true;
+				for (auto &part : parts)
+				{
+					if (entry.first.find(part) == Misc::AnsiString::npos)
+					{
+						foundAll = false;
+						break;
+					}
+				}
+
+				if (foundAll)
+				{
+					best = &entry;
+				}
+			}
+
+			return best != nullptr ? &fonts[best->second] : nullptr;
+		}
+		//---------------------------------------------------------------------------
+		const FontLocator::FontEntry* FontLocator::FindFont(const Misc::AnsiString &family, int weight, bool italic)
+		{
+			EnsureIndex();
+
+			const auto it = familyIndex.find(NormaliseName(family));
+			if (it == familyIndex.end())
+			{
+				return nullptr;
+			}
+
+			const FontEntry *best = nullptr;
+			auto bestScore = 0;
+			for (auto index : it->second)
+			{
+				const auto &entry = fonts[index];
+				const auto score = std::abs(entry.Weight - weight) + (entry.Italic != italic ? 1000 : 0);
+				if (best == nullptr || score < bestScore)
+				{
+					best = &entry;
+					bestScore = score;
+				}
+			}
+
+			return best;
+		}
+		//---------------------------------------------------------------------------
+		void FontLocator::Invalidate()
+		{
+			initialised = false;
+
+			directories.clear();
+			fonts.clear();
+			nameIndex.clear();
+			familyIndex.clear();
+		}
+		//---------------------------------------------------------------------------
+		void FontLocator::EnsureIndex()
+		{
+			if (initialised)
+			{
+				return;
+			}
+			initialised = true;
+
+			if (!cacheFileSet)
+			{
+				SetCacheFile(GetDefaultCacheFile());
+			}
+
+			if (!LoadCache())
+			{
+				Scan();
+				SaveCache();
+			}
+
+			BuildIndex();
+		}
+		//---------------------------------------------------------------------------
+		bool FontLocator::LoadCache()
+		{
+			if (cacheFile.empty())
+			{
+				return false;
+			}
+
+			std::ifstream in(cacheFile);
+			if (!in)
+			{
+				return false;
+			}
+
+			Misc::AnsiString line;
+			if (!std::getline(in, line) || line != CacheHeader)
+			{
+				return false;
+			}
+
+			std::vector<Misc::AnsiString> roots;
+			std::vector<DirectoryInfo> cachedDirectories;
+			std::vector<FontEntry> cachedFonts;
+
+			while (std::getline(in, line))
+			{
+				std::vector<Misc::AnsiString> fields;
+				std::stringstream ss(line);
+				for (Misc::AnsiString field; std::getline(ss, field, '\t'); fields.push_back(field));
+
+				if (fields.size() == 2 && fields[0] == "R")
+				{
+					roots.push_back(fields[1]);
+				}
+				else if (fields.size() == 3 && fields[0] == "D")
+				{
+					DirectoryInfo info = { fields[2], std::atoll(fields[1].c_str()) };
+					if (GetModificationTime(info.Path) != info.ModificationTime)
+					{
+						return false;
+					}
+					cachedDirectories.push_back(info);
+				}
+				else if (fields.size() >= 6 && fields[0] == "F")
+				{
+					FontEntry entry = { fields[4], fields.size() > 6 ? fields[5] : Misc::AnsiString(), std::atoi(fields[1].c_str()), fields[2] == "1", fields.back(), std::atoi(fields[3].c_str()) };
+					cachedFonts.push_back(entry);
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			if (roots != GetDefaultDirectories())
+			{
+				return false;
+			}
+
+			directories = std::move(cachedDirectories);
+			fonts = std::move(cachedFonts);
+
+			return true;
+		}
+		//---------------------------------------------------------------------------
+		void FontLocator::SaveCache()
+		{
+			if (cacheFile.empty())
+			{
+				return;
+			}
+
+			std::ofstream out(cacheFile, std::ios::trunc);
+			if (!out)
+			{
+				return;
+			}
+
+			out << CacheHeader << '\n';
+			for (auto &root : GetDefaultDirectories())
+			{
+				out << "R\t" << root << '\n';
+			}
+			for (auto &directory : directories)
+			{
+				out << "D\t" << directory.ModificationTime << '\t' << directory.Path << '\n';
+			}
+			for (auto &font : fonts)
+			{
+				out << "F\t" << font.Weight << '\t' << (font.Italic ? 1 : 0) << '\t' << font.FaceIndex << '\t' << font.Family << '\t' << font.Style << '\t' << font.Path << '\n';
+			}
+		}
+		//---------------------------------------------------------------------------
+		void FontLocator::Scan()
+		{
+			directories.clear();
+			fonts.clear();
+
+			FT_Library library;
+			if (FT_Init_FreeType(&library) != 0)
+			{
+				return;
+			}
+
+			for (auto &root : GetDefaultDirectories())
+			{
+				ScanDirectory(root, library);
+			}
+
+			FT_Done_FreeType(library);
+		}
+		//---------------------------------------------------------------------------
+		void FontLocator::ScanDirectory(const Misc::AnsiString &directory, FT_Library library)
+		{
+			DirectoryInfo info = { directory, GetModificationTime(directory) };
+			directories.push_back(info);
+
+			if (info.ModificationTime == -1)
+			{
+				return;
+			}
+
+			std::vector<Misc::AnsiString> files;
+			std::vector<Misc::AnsiString> subdirectories;
+			ListDirectory(directory, files, subdirectories);
+
+			for (auto &file : files)
+			{
+				if (!IsFontFile(file))
+				{
+					continue;
+				}
+
+				//Schriftsammlungen (.ttc) enthalten mehrere Faces
+				for (FT_Long faceIndex = 0, faceCount = 1; faceIndex < faceCount; ++faceIndex)
+				{
+					FT_Face face;
+					if (FT_New_Face(library, file.c_str(), faceIndex, &face) != 0)
+					{
+						break;
+					}
+
+					faceCount = face->num_faces;
+
+					if (face->family_name != nullptr && face->charmap != nullptr)
+					{
+						auto weight = face->style_flags & FT_STYLE_FLAG_BOLD ? 700 : 400;
+						if (const auto os2 = static_cast<TT_OS2*>(FT_Get_Sfnt_Table(face, FT_SFNT_OS2)))
+						{
+							if (os2->version != 0xFFFF && os2->usWeightClass != 0)
+							{
+								weight = os2->usWeightClass;
+							}
+						}
+
+						FontEntry entry = {
+							face->family_name,
+							face->style_name != nullptr ? face->style_name : "",
+							weight,
+							(face->style_flags & FT_STYLE_FLAG_ITALIC) != 0,
+							file,
+							static_cast<int>(faceIndex)
+						};
+						fonts.push_back(entry);
+					}
+
+					FT_Done_Face(face);
+				}
+			}
+
+			for (auto &subdirectory : subdirectories)
+			{
+				ScanDirectory(subdirectory, library);
+			}
+		}
+		//---------------------------------------------------------------------------
+		void FontLocator::BuildIndex()
+		{
+			nameIndex.clear();
+			familyIndex.clear();
+
+			for (size_t i = 0; i < fonts.size(); ++i)
+			{
+				const auto &font = fonts[i];
+				const auto family = NormaliseName(font.Family);
+
+				nameIndex.insert(std::make_pair(NormaliseName(font.Family + ' ' + font.Style), i));
+				if (IsRegularStyle(font.Style))
+				{
+					nameIndex.insert(std::make_pair(family, i));
+				}
+
+				familyIndex[family].push_back(i);
+			}
+		}
+		//---------------------------------------------------------------------------
+	}
+}
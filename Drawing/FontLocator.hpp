@@ -0,0 +1,117 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_DRAWING_FONTLOCATOR_HPP
+#define OSHGUI_DRAWING_FONTLOCATOR_HPP
+
+#include <vector>
+#include <unordered_map>
+#include "../Exports.hpp"
+#include "../Misc/Strings.hpp"
+
+typedef struct FT_LibraryRec_ *FT_Library;
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		/**
+		 * Sucht installierte Schriftarten in den Standardverzeichnissen des Systems.
+		 *
+		 * Die Verzeichnisse werden einmalig durchsucht und der Index aus Familie, Stil
+		 * und Gewicht wird in einer Cache-Datei gespeichert. Beim nächsten Start wird
+		 * der Cache verwendet, solange sich die Änderungszeiten der Verzeichnisse nicht
+		 * geändert haben.
+		 */
+		class OSHGUI_EXPORT FontLocator
+		{
+		public:
+			/**
+			 * Ein Eintrag im Schriftindex.
+			 */
+			struct FontEntry
+			{
+				Misc::AnsiString Family;
+				Misc::AnsiString Style;
+				int Weight;
+				bool Italic;
+				Misc::AnsiString Path;
+				//Index des Face in Schriftsammlungen (.ttc)
+				int FaceIndex;
+			};
+
+			/**
+			 * Ruft die Schriftart mit dem entsprechenden Namen ab (z.B. "Arial Bold").
+			 *
+			 * \param name Name der Schriftart
+			 * \return nullptr, falls die Schriftart nicht gefunden wird
+			 */
+			static const FontEntry* FindFont(const Misc::AnsiString &name);
+			/**
+			 * Ruft die Schriftart der Familie ab, deren Gewicht am nächsten an \a weight liegt.
+			 *
+			 * \param family Name der Schriftfamilie
+			 * \param weight Gewicht der Schrift (400 = normal, 700 = fett)
+			 * \param italic Legt fest, ob eine kursive Schrift gesucht wird
+			 * \return nullptr, falls die Familie nicht gefunden wird
+			 */
+			static const FontEntry* FindFont(const Misc::AnsiString &family, int weight, bool italic);
+			/**
+			 * Ruft alle gefundenen Schriftarten ab.
+			 *
+			 * \return Liste der Schriftarten
+			 */
+			static const std::vector<FontEntry>& GetFonts();
+
+			/**
+			 * Fügt ein zusätzliches Verzeichnis hinzu, das nach Schriftarten durchsucht wird.
+			 *
+			 * \param directory
+			 */
+			static void AddFontDirectory(const Misc::AnsiString &directory);
+			/**
+			 * Legt den Pfad der Cache-Datei fest. Ein leerer Pfad deaktiviert den Cache.
+			 *
+			 * \param file
+			 */
+			static void SetCacheFile(const Misc::AnsiString &file);
+			/**
+			 * Verwirft den Index, damit die Verzeichnisse bei der nächsten Suche neu durchsucht werden.
+			 */
+			static void Invalidate();
+
+		private:
+			struct DirectoryInfo
+			{
+				Misc::AnsiString Path;
+				long long ModificationTime;
+			};
+
+			static void EnsureIndex();
+			static bool LoadCache();
+			static void SaveCache();
+			static void Scan();
+			static void ScanDirectory(const Misc::AnsiString &directory, FT_Library library);
+			static void BuildIndex();
+
+			static std::vector<Misc::AnsiString> GetDefaultDirectories();
+			static Misc::AnsiString GetDefaultCacheFile();
+
+			static bool initialised;
+			static bool cacheFileSet;
+			static Misc::AnsiString cacheFile;
+			static std::vector<Misc::AnsiString> extraDirectories;
+			static std::vector<DirectoryInfo> directories;
+			static std::vector<FontEntry> fonts;
+			static std::unordered_map<Misc::AnsiString, size_t> nameIndex;
+			static std::unordered_map<Misc::AnsiString, std::vector<size_t>> familyIndex;
+		};
+	}
+}
+
+#endif
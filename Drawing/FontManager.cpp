@@ -1,128 +1,102 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#include "FontManager.hpp"
-#include "../Misc/Exceptions.hpp"
-#include "../Misc/HashTuple.hpp"
-#include "FreeTypeFont.hpp"
-#include "GDIFont.hpp"
-#include <windows.h>
-#include <algorithm>
-#include <vector>
-#include <sstream>
-
-namespace OSHGui
-{
-	namespace Drawing
-	{
-		std::unordered_map<std::tuple<Misc::AnsiString, float, bool, Font::Effect>, std::weak_ptr<Drawing::Font>> FontManager::loadedFonts;
-		//---------------------------------------------------------------------------
-		FontPtr FontManager::LoadFreeTypeFont(Misc::AnsiString name, float pointSize, bool antiAliased, Font::Effect effect)
-		{
-			if (name.empty())
-			{
-				throw Misc::ArgumentException();
-			}
-
-			std::transform(name.begin(), name.end(), name.begin(), ::tolower);
-			std::vector<std::string> parts;
-			std::stringstream ss(name);
-			for (std::string s; ss >> s; parts.push_back(s));
-
-			FontPtr font = nullptr;
-
-			char keyNameBuffer[MAX_PATH];
-			char keyValueBuffer[MAX_PATH];
-
-			HKEY fontKey;
-			if (RegOpenKeyExA(HKEY_LOCAL_MACHINE, "SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion\\Fonts", 0, KEY_READ, &fontKey) == ERROR_SUCCESS)
-			{
-				int i = 0;
-				int lastError = ERROR_SUCCESS;
-				do
-				{
-					DWORD keyNameLength = sizeof(keyNameBuffer);
-					DWORD keyValueLength = sizeof(keyValueBuffer);
-
-					lastError = RegEnumValueA(fontKey, i, keyNameBuffer, &keyNameLength, nullptr, nullptr, reinterpret_cast<uint8_t*>(keyValueBuffer), &keyValueLength);
-					if (lastError == ERROR_SUCCESS)
-					{
-						std::string keyName(keyNameBuffer);
-						if (keyName.find(" (TrueType)") != std::string::npos || keyName.find(" (OpenType)") != std::string::npos)
-						{
-							keyName.erase(keyName.length() - 11);
-						}
-
-						if (keyName.length() == name.length())
-						{
-							std::transform(keyName.begin(), keyName.end(), keyName.begin(), ::tolower);
-
-							auto foundAll = true;
-							for (auto &part : parts)
-							{
-								if (keyName.find(part) == std::string::npos)
-								{
-									foundAll = false;
-									break;
-								}
-							}
-
-							if (foundAll)
-							{
-								char path[MAX_PATH] = { };
-								ExpandEnvironmentStringsA((std::string("%windir%\\fonts\\") + keyValueBuffer).c_str(), path, sizeof(path));
-
-								RegCloseKey(fontKey);
-
-								return LoadFreeTypeFontFromFile(path, pointSize, antiAliased, effect);
-							}
-						}
-					}
-
-					++i;
-				} while (lastError != ERROR_NO_MORE_ITEMS);
-
-				RegCloseKey(fontKey);
-			}
-
-			throw Misc::ArgumentException();
-		}
-		//---------------------------------------------------------------------------
-		FontPtr FontManager::LoadFreeTypeFontFromFile(const Misc::AnsiString &filename, float pointSize, bool antiAliased, Font::Effect effect)
-		{
-			auto cacheEntry = std::make_tuple(filename, pointSize, antiAliased, effect);
-			const auto it = loadedFonts.find(cacheEntry);
-			if (it == std::end(loadedFonts) || it->second.expired())
-			{
-				auto font = std::make_shared<FreeTypeFont>(filename, pointSize, antiAliased, effect);
-				loadedFonts[cacheEntry] = font;
-				return font;
-			}
-			return it->second.lock();
-		}
-		//---------------------------------------------------------------------------
-		FontPtr FontManager::LoadFreeTypeFontFromMemory(const Misc::RawDataContainer &data, float pointSize, bool antiAliased, Font::Effect effect)
-		{
-			return std::make_shared<FreeTypeFont>(data, pointSize, antiAliased, effect);
-		}
-		//---------------------------------------------------------------------------
-		void FontManager::DisplaySizeChanged(const SizeF &size)
-		{
-			for (auto &font : loadedFonts)
-			{
-				font.second.lock()->DisplaySizeChanged(size);
-			}
-		}
-		//---------------------------------------------------------------------------
-		FontPtr FontManager::LoadGDIFont(Misc::AnsiString name, float pointSize, bool antiAliased, Font::Effect effect)
-		{
-			return std::make_shared<GDIFont>(name, pointSize, antiAliased, effect);
-		}
-		//---------------------------------------------------------------------------
-	}
-}
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "FontManager.hpp"
+#include "../Misc/Exceptions.hpp"
+#include "../Misc/HashTuple.hpp"
+#include "FontLocator.hpp"
+#include "FreeTypeFont.hpp"
+#ifdef _WIN32
+#include "GDIFont.hpp"
+#endif
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		std::unordered_map<std::tuple<Misc::AnsiString, float, bool, Font::Effect, bool>, std::weak_ptr<Drawing::Font>> FontManager::loadedFonts;
+		//---------------------------------------------------------------------------
+		FontPtr FontManager::LoadFreeTypeFont(Misc::AnsiString name, float pointSize, bool antiAliased, Font::Effect effect, bool distanceField)
+		{
+			if (name.empty())
+			{
+				throw Misc::ArgumentException();
+			}
+
+			const auto entry = FontLocator::FindFont(name);
+			if (entry != nullptr)
+			{
+				return LoadFreeTypeFontFromFile(entry->Path, pointSize, antiAliased, effect, distanceField, entry->FaceIndex);
+			}
+
+			throw Misc::ArgumentException();
+		}
+		//---------------------------------------------------------------------------
+		FontPtr FontManager::LoadFreeTypeFontFromFile(const Misc::AnsiString &filename, float pointSize, bool antiAliased, Font::Effect effect, bool distanceField, int faceIndex)
+		{
+			auto face = FreeTypeFace::FromFile(filename, faceIndex);
+
+			auto cacheEntry = std::make_tuple(face->GetKey(), pointSize, antiAliased, effect, distanceField);
+			const auto it = loadedFonts.find(cacheEntry);
+			if (it == std::end(loadedFonts) || it->second.expired())
+			{
+				auto font = std::make_shared<FreeTypeFont>(std::move(face), pointSize, antiAliased, effect, 0.0f, distanceField);
+				loadedFonts[cacheEntry] = font;
+				return font;
+			}
+			return it->second.lock();
+		}
+		//---------------------------------------------------------------------------
+		FontPtr FontManager::LoadFreeTypeFontFromMemory(const Misc::RawDataContainer &data, float pointSize, bool antiAliased, Font::Effect effect, bool distanceField)
+		{
+			auto face = FreeTypeFace::FromMemory(data);
+
+			auto cacheEntry = std::make_tuple(face->GetKey(), pointSize, antiAliased, effect, distanceField);
+			const auto it = loadedFonts.find(cacheEntry);
+			if (it == std::end(loadedFonts) || it->second.expired())
+			{
+				auto font = std::make_shared<FreeTypeFont>(std::move(face), pointSize, antiAliased, effect, 0.0f, distanceField);
+				loadedFonts[cacheEntry] = font;
+				return font;
+			}
+			return it->second.lock();
+		}
+		//---------------------------------------------------------------------------
+		void FontManager::DisplaySizeChanged(const SizeF &size)
+		{
+			for (auto it = std::begin(loadedFonts); it != std::end(loadedFonts); )
+			{
+				if (auto font = it->second.lock())
+				{
+					font->DisplaySizeChanged(size);
+
+					++it;
+				}
+				else
+				{
+					it = loadedFonts.erase(it);
+				}
+			}
+		}
+		//---------------------------------------------------------------------------
+		FontPtr FontManager::LoadGDIFont(Misc::AnsiString name, float pointSize, bool antiAliased, Font::Effect effect)
+		{
+			#ifdef _WIN32
+			return std::make_shared<GDIFont>(name, pointSize, antiAliased, effect);
+			#else
+			(void)name;
+			(void)pointSize;
+			(void)antiAliased;
+			(void)effect;
+
+			throw Misc::NotSupportedException();
+			#endif
+		}
+		//---------------------------------------------------------------------------
+	}
+}
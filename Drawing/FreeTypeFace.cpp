@@ -0,0 +1,196 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "FreeTypeFace.hpp"
+#include "../Misc/Exceptions.hpp"
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		//---------------------------------------------------------------------------
+		//static attributes
+		//---------------------------------------------------------------------------
+		std::unordered_map<Misc::AnsiString, std::weak_ptr<FreeTypeFace>> FreeTypeFace::loadedFaces;
+		//---------------------------------------------------------------------------
+		namespace
+		{
+			FT_Library freeType = nullptr;
+			int freeTypeUsageCounter = 0;
+			//---------------------------------------------------------------------------
+			void AcquireLibrary()
+			{
+				if (!freeTypeUsageCounter++)
+				{
+					FT_Init_FreeType(&freeType);
+				}
+			}
+			//---------------------------------------------------------------------------
+			void ReleaseLibrary()
+			{
+				if (!--freeTypeUsageCounter)
+				{
+					FT_Done_FreeType(freeType);
+					freeType = nullptr;
+				}
+			}
+			//---------------------------------------------------------------------------
+			uint64_t HashData(const Misc::RawDataContainer &data)
+			{
+				//FNV-1a
+				auto hash = 14695981039346656037ULL;
+				for (auto b : data.GetData())
+				{
+					hash = (hash ^ b) * 1099511628211ULL;
+				}
+				return hash;
+			}
+		}
+		//---------------------------------------------------------------------------
+		//Constructor
+		//---------------------------------------------------------------------------
+		FreeTypeFace::FreeTypeFace(Misc::AnsiString _key, Misc::RawDataContainer _data, int faceIndex)
+			: key(std::move(_key)),
+			  data(std::move(_data)),
+			  face(nullptr),
+			  dataHash(0),
+			  hasDataHash(false)
+		{
+			AcquireLibrary();
+
+			if (FT_New_Memory_Face(freeType, data.GetDataPointer(), static_cast<FT_Long>(data.GetSize()), faceIndex, &face) != 0)
+			{
+				face = nullptr;
+
+				ReleaseLibrary();
+
+				throw Misc::Exception();
+			}
+
+			if (!face->charmap)
+			{
+				FT_Done_Face(face);
+				face = nullptr;
+
+				ReleaseLibrary();
+
+				throw Misc::Exception();
+			}
+		}
+		//---------------------------------------------------------------------------
+		FreeTypeFace::~FreeTypeFace()
+		{
+			const auto it = loadedFaces.find(key);
+			if (it != std::end(loadedFaces) && it->second.expired())
+			{
+				loadedFaces.erase(it);
+			}
+
+			FT_Done_Face(face);
+
+			ReleaseLibrary();
+		}
+		//---------------------------------------------------------------------------
+		//Getter/Setter
+		//---------------------------------------------------------------------------
+		FT_Face FreeTypeFace::GetFace() const
+		{
+			return face;
+		}
+		//---------------------------------------------------------------------------
+		const Misc::AnsiString& FreeTypeFace::GetKey() const
+		{
+			return key;
+		}
+		//---------------------------------------------------------------------------
+		uint64_t FreeTypeFace::GetDataHash() const
+		{
+			if (!hasDataHash)
+			{
+				dataHash = HashData(data);
+				hasDataHash = true;
+			}
+			return dataHash;
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		std::shared_ptr<FreeTypeFace> FreeTypeFace::FromFile(const Misc::AnsiString &filename, int faceIndex)
+		{
+			const auto key = faceIndex != 0 ? filename + ':' + std::to_string(faceIndex) : filename;
+
+			const auto it = loadedFaces.find(key);
+			if (it != std::end(loadedFaces))
+			{
+				if (auto face = it->second.lock())
+				{
+					return face;
+				}
+			}
+
+			Misc::RawDataContainer data;
+			data.LoadFromFile(filename);
+
+			return Acquire(key, std::move(data), faceIndex);
+		}
+		//---------------------------------------------------------------------------
+		std::shared_ptr<FreeTypeFace> FreeTypeFace::FromMemory(const Misc::RawDataContainer &data)
+		{
+			const auto hash = HashData(data);
+
+			std::stringstream ss;
+			ss << "memory:" << std::hex << std::setw(16) << std::setfill('0') << hash << ':' << std::dec << data.GetSize();
+			auto key = ss.str();
+
+			for (auto collision = 1; ; ++collision)
+			{
+				const auto it = loadedFaces.find(key);
+				if (it == std::end(loadedFaces))
+				{
+					break;
+				}
+
+				auto face = it->second.lock();
+				if (!face)
+				{
+					break;
+				}
+				if (face->data.GetSize() == data.GetSize() && std::memcmp(face->data.GetDataPointer(), data.GetDataPointer(), data.GetSize()) == 0)
+				{
+					return face;
+				}
+
+				//hash collision, use a distinct key for these data
+				ss << '#' << collision;
+				key = ss.str();
+			}
+
+			auto face = Acquire(key, data, 0);
+			face->dataHash = hash;
+			face->hasDataHash = true;
+
+			return face;
+		}
+		//---------------------------------------------------------------------------
+		std::shared_ptr<FreeTypeFace> FreeTypeFace::Acquire(const Misc::AnsiString &key, Misc::RawDataContainer data, int faceIndex)
+		{
+			std::shared_ptr<FreeTypeFace> face(new FreeTypeFace(key, std::move(data), faceIndex));
+
+			loadedFaces[key] = face;
+
+			return face;
+		}
+		//---------------------------------------------------------------------------
+	}
+}
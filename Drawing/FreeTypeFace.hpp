@@ -0,0 +1,92 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_DRAWING_FREETYPEFACE_HPP
+#define OSHGUI_DRAWING_FREETYPEFACE_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+#include "../Exports.hpp"
+#include "../Misc/Strings.hpp"
+#include "../Misc/RawDataContainer.hpp"
+
+typedef struct FT_FaceRec_*  FT_Face;
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		/**
+		 * Gemeinsam genutzte FreeType-Schriftdatei.
+		 *
+		 * Die Daten einer Schriftdatei und das zugehörige FT_Face werden nur einmal geladen
+		 * und von allen FreeTypeFont-Instanzen geteilt, die diese Datei verwenden. Jede
+		 * Schriftgröße wird als eigenes FT_Size-Objekt an dem geteilten Face erzeugt.
+		 */
+		class OSHGUI_EXPORT FreeTypeFace
+		{
+		public:
+			/**
+			 * Ruft das Face für die angegebene Datei ab und lädt es, falls es noch nicht geladen ist.
+			 *
+			 * \param filename Pfad zur Datei
+			 * \param faceIndex Index des Face in Schriftsammlungen (.ttc)
+			 * \return das geteilte Face
+			 */
+			static std::shared_ptr<FreeTypeFace> FromFile(const Misc::AnsiString &filename, int faceIndex = 0);
+			/**
+			 * Ruft das Face für die angegebenen Daten ab. Identische Daten teilen sich ein Face.
+			 *
+			 * \param data Inhalt der Schriftdatei
+			 * \return das geteilte Face
+			 */
+			static std::shared_ptr<FreeTypeFace> FromMemory(const Misc::RawDataContainer &data);
+
+			~FreeTypeFace();
+
+			/**
+			 * Ruft das FreeType-Handle ab.
+			 *
+			 * \return face
+			 */
+			FT_Face GetFace() const;
+			/**
+			 * Ruft den Schlüssel ab, unter dem das Face geteilt wird.
+			 *
+			 * \return key
+			 */
+			const Misc::AnsiString& GetKey() const;
+			/**
+			 * Ruft den Hashwert des Inhalts der Schriftdatei ab. Der Wert wird beim ersten Aufruf berechnet.
+			 *
+			 * \return hash
+			 */
+			uint64_t GetDataHash() const;
+
+		private:
+			FreeTypeFace(Misc::AnsiString key, Misc::RawDataContainer data, int faceIndex);
+
+			//copying prohibited
+			FreeTypeFace(const FreeTypeFace&);
+			void operator=(const FreeTypeFace&);
+
+			static std::shared_ptr<FreeTypeFace> Acquire(const Misc::AnsiString &key, Misc::RawDataContainer data, int faceIndex);
+
+			Misc::AnsiString key;
+			Misc::RawDataContainer data;
+			FT_Face face;
+			mutable uint64_t dataHash;
+			mutable bool hasDataHash;
+
+			static std::unordered_map<Misc::AnsiString, std::weak_ptr<FreeTypeFace>> loadedFaces;
+		};
+	}
+}
+
+#endif
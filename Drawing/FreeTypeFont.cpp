@@ -1,438 +1,854 @@
-#include "FreeTypeFont.hpp"
-#include "Texture.hpp"
-#include "../Application.hpp"
-#include "../Misc/Exceptions.hpp"
-
-#include <ft2build.h>
-#include FT_FREETYPE_H
-
-#undef DrawText
-
-namespace OSHGui
-{
-	namespace Drawing
-	{
-		//---------------------------------------------------------------------------
-		//static attributes
-		//---------------------------------------------------------------------------
-		const unsigned int GlyphPadding = 2;
-		const float FT_PosCoefficient = 1.0f / 64.0f;
-		//---------------------------------------------------------------------------
-		FT_Library freeType = nullptr;
-		int freeTypeUsageCounter = 0;
-		//---------------------------------------------------------------------------
-		//Constructor
-		//---------------------------------------------------------------------------
-		FreeTypeFont::FreeTypeFont(const Misc::AnsiString &filename, const float _pointSize, const bool _antiAliased, const Effect _effect, const float _lineSpacing)
-			: lineSpacing(_lineSpacing),
-			  pointSize(_pointSize),
-			  antiAliased(_antiAliased),
-			  fontFace(nullptr)
-		{
-			effect = _effect;
-
-			if (!freeTypeUsageCounter++)
-			{
-				FT_Init_FreeType(&freeType);
-			}
-
-			data.LoadFromFile(filename);
-
-			UpdateFont();
-		}
-		//---------------------------------------------------------------------------
-		FreeTypeFont::FreeTypeFont(Misc::RawDataContainer _data, const float _pointSize, const bool _antiAliased, const Effect _effect, const float _lineSpacing)
-			: lineSpacing(_lineSpacing),
-			  pointSize(_pointSize),
-			  antiAliased(_antiAliased),
-			  fontFace(nullptr),
-			  data(std::move(_data))
-		{
-			effect = _effect;
-
-			if (!freeTypeUsageCounter++)
-			{
-				FT_Init_FreeType(&freeType);
-			}
-
-			UpdateFont();
-		}
-		//---------------------------------------------------------------------------
-		FreeTypeFont::~FreeTypeFont()
-		{
-			Free();
-
-			if (!--freeTypeUsageCounter)
-			{
-				FT_Done_FreeType(freeType);
-			}
-		}
-		//---------------------------------------------------------------------------
-		//Getter/Setter
-		//---------------------------------------------------------------------------
-		float FreeTypeFont::GetPointSize() const
-		{
-			return pointSize;
-		}
-		//---------------------------------------------------------------------------
-		void FreeTypeFont::SetPointSize(const float _pointSize)
-		{
-			if (pointSize == _pointSize)
-			{
-				return;
-			}
-
-			pointSize = _pointSize;
-
-			UpdateFont();
-		}
-		//---------------------------------------------------------------------------
-		bool FreeTypeFont::IsAntiAliased() const
-		{
-			return antiAliased;
-		}
-		//---------------------------------------------------------------------------
-		void FreeTypeFont::SetAntiAliased(const bool _antiAliasing)
-		{
-			if (antiAliased == _antiAliasing)
-			{
-				return;
-			}
-
-			antiAliased = _antiAliasing;
-
-			UpdateFont();
-		}
-		//---------------------------------------------------------------------------
-		const FontGlyph* FreeTypeFont::FindFontGlyph(const uint32_t codepoint) const
-		{
-			auto it = glyphMap.find(codepoint);
-			if (it == glyphMap.end())
-			{
-				return nullptr;
-			}
-
-			if (!it->second.IsValid())
-			{
-				InitialiseFontGlyph(it);
-			}
-
-			return &it->second;
-		}
-		//---------------------------------------------------------------------------
-		//Runtime-Functions
-		//---------------------------------------------------------------------------
-		uint32_t FreeTypeFont::GetTextureSize(CodepointIterator start, CodepointIterator end) const
-		{
-			auto size = 32;
-			const auto maximum = Application::Instance().GetRenderer().GetMaximumTextureSize();
-			auto count = 0;
-
-			while (size < maximum)
-			{
-				auto x = GlyphPadding;
-				auto y = GlyphPadding;
-				auto yb = GlyphPadding;
-				for (auto c = start; c != end; ++c)
-				{
-					if (c->second.GetImage())
-					{
-						continue;
-					}
-
-					if (FT_Load_Char(fontFace, c->first, FT_LOAD_DEFAULT | FT_LOAD_FORCE_AUTOHINT) != 0)
-					{
-						continue;
-					}
-
-					const auto glyphWidth = static_cast<int>(std::ceil(fontFace->glyph->metrics.width * FT_PosCoefficient)) + GlyphPadding + static_cast<uint32_t>(effect);
-					const auto glyphHeight = static_cast<int>(std::ceil(fontFace->glyph->metrics.height * FT_PosCoefficient)) + GlyphPadding + static_cast<uint32_t>(effect);
-
-					x += glyphWidth;
-					if (x > size)
-					{
-						x = GlyphPadding;
-						y = yb;
-					}
-					const auto yy = y + glyphHeight;
-					if (yy > size)
-					{
-						goto too_small;
-					}
-
-					if (yy > yb)
-					{
-						yb = yy;
-					}
-
-					++count;
-				}
-				break;
-
-				too_small:
-				size *= 2;
-			}
-
-			return count ? size : 0;
-		}
-		//---------------------------------------------------------------------------
-		void FreeTypeFont::Rasterise(uint32_t startCodepoint, uint32_t endCodepoint) const
-		{
-			auto start = glyphMap.lower_bound(startCodepoint);
-			if (start == glyphMap.end())
-			{
-				return;
-			}
-
-			const auto bck = start;
-			const auto end = glyphMap.upper_bound(endCodepoint);
-			while (true)
-			{
-				const auto textureSize = GetTextureSize(start, end);
-				if (textureSize == 0)
-				{
-					break;
-				}
-
-				auto texture = Application::Instance().GetRenderer().CreateTexture(SizeF(textureSize, textureSize));
-				glyphTextures.push_back(texture);
-
-				std::vector<uint32_t> buffer(textureSize * textureSize);
-				
-				auto x = GlyphPadding;
-				auto y = GlyphPadding;
-				auto yb = GlyphPadding;
-
-				bool finished = false;
-				bool forward = true;
-
-				while (start != glyphMap.end())
-				{
-					finished |= (start == end);
-
-					if (!start->second.GetImage())
-					{
-						if (FT_Load_Char(fontFace, start->first, FT_LOAD_RENDER | (antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO)) != 0)
-						{
-							const auto image = std::make_shared<Image>(texture, RectangleF(0, 0, 0, 0), PointF(0, 0));
-							glyphImages.push_back(image);
-							start->second.SetImage(image);
-						}
-						else
-						{
-							const auto glyphWidth = fontFace->glyph->bitmap.width + GlyphPadding + static_cast<uint32_t>(effect);
-							const auto glyphHeight = fontFace->glyph->bitmap.rows + GlyphPadding + static_cast<uint32_t>(effect);
-
-							auto next = x + glyphWidth;
-							if (next > textureSize)
-							{
-								x = GlyphPadding;
-								next = x + glyphWidth;
-								y = yb;
-							}
-
-							const auto bottom = y + glyphHeight;
-							if (bottom > textureSize)
-							{
-								break;
-							}
-
-							DrawGlyphToBuffer(buffer.data() + (y * textureSize) + x, textureSize);
-
-							RectangleF area(x, y, glyphWidth - GlyphPadding, glyphHeight - GlyphPadding);
-							PointF offset(fontFace->glyph->metrics.horiBearingX * FT_PosCoefficient, -fontFace->glyph->metrics.horiBearingY * FT_PosCoefficient);
-
-							const auto image = std::make_shared<Image>(texture, area, offset);
-							glyphImages.push_back(image);
-							start->second.SetImage(image);
-
-							x = next;
-							if (bottom > yb)
-							{
-								yb = bottom;
-							}
-						}
-					}
-
-					if (forward)
-					{
-						if (++start == glyphMap.end())
-						{
-							finished = true;
-							forward = false;
-							start = bck;
-						}
-					}
-					if (!forward)
-					{
-						if ((start == glyphMap.begin()) || (--start == glyphMap.begin()))
-						{
-							break;
-						}
-					}
-				}
-
-				ApplyEffect(buffer.data(), textureSize, textureSize);
-
-				texture->LoadFromMemory(buffer.data(), SizeF(textureSize, textureSize), Texture::PixelFormat::RGBA);
-
-				if (finished)
-				{
-					break;
-				}
-			}
-		}
-		//---------------------------------------------------------------------------
-		void FreeTypeFont::DrawGlyphToBuffer(uint32_t *buffer, uint32_t width) const
-		{
-			const auto bitmap = &fontFace->glyph->bitmap;
-
-			for (auto i = 0; i < bitmap->rows; ++i)
-			{
-				auto src = bitmap->buffer + (i * bitmap->pitch);
-				switch (bitmap->pixel_mode)
-				{
-					case FT_PIXEL_MODE_GRAY:
-						{
-							auto dst = reinterpret_cast<uint8_t*>(buffer);
-							for (auto j = 0; j < bitmap->width; ++j)
-							{
-								*dst++ = 0xFF;
-								*dst++ = 0xFF;
-								*dst++ = 0xFF;
-								*dst++ = *src++;
-							}
-						}
-						break;
-					case FT_PIXEL_MODE_MONO:
-						for (auto j = 0; j < bitmap->width; ++j)
-						{
-							buffer[j] = (src[j / 8] & (0x80 >> (j & 7))) ? 0xFFFFFFFF : 0x00000000;
-						}
-						break;
-					default:
-						throw;
-				}
-
-				buffer += width;
-			}
-		}
-		//---------------------------------------------------------------------------
-		void FreeTypeFont::Free()
-		{
-			if (!fontFace)
-			{
-				return;
-			}
-
-			glyphMap.clear();
-			glyphImages.clear();
-			glyphTextures.clear();
-
-			FT_Done_Face(fontFace);
-			fontFace = nullptr;
-		}
-		//---------------------------------------------------------------------------
-		void FreeTypeFont::UpdateFont()
-		{
-			Free();
-
-			if (FT_New_Memory_Face(freeType, data.GetDataPointer(), static_cast<FT_Long>(data.GetSize()), 0, &fontFace) != 0)
-			{
-				throw Misc::Exception();
-			}
-
-			if (!fontFace->charmap)
-			{
-				FT_Done_Face(fontFace);
-				fontFace = nullptr;
-
-				throw Misc::Exception();
-			}
-
-			const auto dpiHorizontal = static_cast<uint32_t>(Application::Instance().GetRenderer().GetDisplayDPI().X);
-			const auto dpiVertical = static_cast<uint32_t>(Application::Instance().GetRenderer().GetDisplayDPI().Y);
-
-			const auto hps = pointSize * 64.0f;
-			const auto vps = pointSize * 64.0f;
-
-			if (FT_Set_Char_Size(fontFace, FT_F26Dot6(hps), FT_F26Dot6(vps), dpiHorizontal, dpiVertical) != 0)
-			{
-				const auto ptSize72 = (pointSize * 72.0f) / dpiVertical;
-				auto bestDelta = 99999.0f;
-				auto bestSize = 0.0f;
-				for (int i = 0; i < fontFace->num_fixed_sizes; i++)
-				{
-					const auto size = fontFace->available_sizes[i].size * FT_PosCoefficient;
-					const auto delta = std::abs(size - ptSize72);
-					if (delta < bestDelta)
-					{
-						bestDelta = delta;
-						bestSize = size;
-					}
-				}
-
-				if (bestSize <= 0.0f || FT_Set_Char_Size(fontFace, 0, FT_F26Dot6(bestSize * 64), 0, 0) != 0)
-				{
-					throw Misc::Exception();
-				}
-			}
-
-			if (fontFace->face_flags & FT_FACE_FLAG_SCALABLE)
-			{
-				const auto scaleY = fontFace->size->metrics.y_scale * FT_PosCoefficient * (1.0f / 65536.0f);
-				ascender = fontFace->ascender * scaleY;
-				descender = fontFace->descender * scaleY;
-				height = fontFace->height * scaleY;
-			}
-			else
-			{
-				ascender = fontFace->size->metrics.ascender * FT_PosCoefficient;
-				descender = fontFace->size->metrics.descender * FT_PosCoefficient;
-				height = fontFace->size->metrics.height * FT_PosCoefficient;
-			}
-
-			if (lineSpacing > 0.0f)
-			{
-				height = lineSpacing;
-			}
-
-			InitialiseGlyphMap();
-		}
-		//---------------------------------------------------------------------------
-		void FreeTypeFont::InitialiseGlyphMap()
-		{
-			FT_UInt index;
-			auto codepoint = FT_Get_First_Char(fontFace, &index);
-			auto maximum = codepoint;
-
-			while (index)
-			{
-				if (maximum < codepoint)
-				{
-					maximum = codepoint;
-				}
-
-				glyphMap[codepoint] = FontGlyph();
-
-				codepoint = FT_Get_Next_Char(fontFace, codepoint, &index);
-			}
-
-			SetMaxCodepoint(maximum);
-		}
-		//---------------------------------------------------------------------------
-		void FreeTypeFont::InitialiseFontGlyph(CodepointIterator it) const
-		{
-			if (FT_Load_Char(fontFace, it->first, FT_LOAD_DEFAULT) != 0)
-			{
-				return;
-			}
-
-			const auto advance = fontFace->glyph->metrics.horiAdvance * FT_PosCoefficient;
-
-			it->second.SetAdvance(advance);
-			it->second.SetValid(true);
-		}
-		//---------------------------------------------------------------------------
-	}
-}
+#include "FreeTypeFont.hpp"
+#include "Texture.hpp"
+#include "GlyphAtlasCache.hpp"
+#include "../Application.hpp"
+#include "../Misc/Exceptions.hpp"
+#include <cmath>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_SIZES_H
+
+#undef DrawText
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		//---------------------------------------------------------------------------
+		//static attributes
+		//---------------------------------------------------------------------------
+		const unsigned int GlyphPadding = 2;
+		const float FT_PosCoefficient = 1.0f / 64.0f;
+		//em size in pixels distance fields are rasterised at
+		const unsigned int DistanceFieldSize = 48;
+		//maximum distance in pixels stored in a distance field
+		const unsigned int DistanceFieldSpread = 6;
+		//---------------------------------------------------------------------------
+		namespace
+		{
+			const float DistanceInfinity = 1e20f;
+			//---------------------------------------------------------------------------
+			//squared euclidean distance transform (Felzenszwalb & Huttenlocher)
+			void DistanceTransform(std::vector<float> &grid, const int width, const int height)
+			{
+				const auto length = std::max(width, height);
+				std::vector<float> f(length);
+				std::vector<float> d(length);
+				std::vector<float> z(length + 1);
+				std::vector<int> v(length);
+
+				const auto transform = [&](const int n)
+				{
+					auto k = 0;
+					v[0] = 0;
+					z[0] = -DistanceInfinity;
+					z[1] = DistanceInfinity;
+					for (auto q = 1; q < n; ++q)
+					{
+						auto s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+						while (s <= z[k])
+						{
+							--k;
+							s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+						}
+						++k;
+						v[k] = q;
+						z[k] = s;
+						z[k + 1] = DistanceInfinity;
+					}
+
+					k = 0;
+					for (auto q = 0; q < n; ++q)
+					{
+						while (z[k + 1] < q)
+						{
+							++k;
+						}
+						d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+					}
+				};
+
+				for (auto x = 0; x < width; ++x)
+				{
+					for (auto y = 0; y < height; ++y)
+					{
+						f[y] = grid[y * width + x];
+					}
+					transform(height);
+					for (auto y = 0; y < height; ++y)
+					{
+						grid[y * width + x] = d[y];
+					}
+				}
+				for (auto y = 0; y < height; ++y)
+				{
+					std::copy(grid.begin() + y * width, grid.begin() + (y + 1) * width, f.begin());
+					transform(width);
+					std::copy(d.begin(), d.begin() + width, grid.begin() + y * width);
+				}
+			}
+		}
+		//---------------------------------------------------------------------------
+		//Constructor
+		//---------------------------------------------------------------------------
+		FreeTypeFont::FreeTypeFont(const Misc::AnsiString &filename, const float _pointSize, const bool _antiAliased, const Effect _effect, const float _lineSpacing, const bool _distanceField)
+			: FreeTypeFont(FreeTypeFace::FromFile(filename), _pointSize, _antiAliased, _effect, _lineSpacing, _distanceField)
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		FreeTypeFont::FreeTypeFont(Misc::RawDataContainer _data, const float _pointSize, const bool _antiAliased, const Effect _effect, const float _lineSpacing, const bool _distanceField)
+			: FreeTypeFont(FreeTypeFace::FromMemory(_data), _pointSize, _antiAliased, _effect, _lineSpacing, _distanceField)
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		FreeTypeFont::FreeTypeFont(std::shared_ptr<FreeTypeFace> _face, const float _pointSize, const bool _antiAliased, const Effect _effect, const float _lineSpacing, const bool _distanceField)
+			: lineSpacing(_lineSpacing),
+			  pointSize(_pointSize),
+			  antiAliased(_antiAliased),
+			  distanceField(_distanceField),
+			  face(std::move(_face)),
+			  fontFace(face->GetFace()),
+			  fontSize(nullptr),
+			  displayDPI(0, 0)
+		{
+			effect = _effect;
+
+			UpdateFont();
+		}
+		//---------------------------------------------------------------------------
+		FreeTypeFont::~FreeTypeFont()
+		{
+			Free();
+		}
+		//---------------------------------------------------------------------------
+		//Getter/Setter
+		//---------------------------------------------------------------------------
+		float FreeTypeFont::GetPointSize() const
+		{
+			return pointSize;
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::SetPointSize(const float _pointSize)
+		{
+			if (pointSize == _pointSize)
+			{
+				return;
+			}
+
+			pointSize = _pointSize;
+
+			UpdateFont();
+		}
+		//---------------------------------------------------------------------------
+		bool FreeTypeFont::IsAntiAliased() const
+		{
+			return antiAliased;
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::SetAntiAliased(const bool _antiAliasing)
+		{
+			if (antiAliased == _antiAliasing)
+			{
+				return;
+			}
+
+			antiAliased = _antiAliasing;
+
+			UpdateFont();
+		}
+		//---------------------------------------------------------------------------
+		bool FreeTypeFont::IsDistanceField() const
+		{
+			return distanceField;
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::SetDistanceField(const bool _distanceField)
+		{
+			if (distanceField == _distanceField)
+			{
+				return;
+			}
+
+			distanceField = _distanceField;
+
+			//the glyphs have to be rasterised again
+			Free();
+
+			UpdateFont();
+		}
+		//---------------------------------------------------------------------------
+		const FontGlyph* FreeTypeFont::FindFontGlyph(const uint32_t codepoint) const
+		{
+			auto it = glyphMap.find(codepoint);
+			if (it == glyphMap.end())
+			{
+				return nullptr;
+			}
+
+			if (!it->second.IsValid())
+			{
+				InitialiseFontGlyph(it);
+			}
+
+			return &it->second;
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		uint32_t FreeTypeFont::GetTextureSize(CodepointIterator start, CodepointIterator end) const
+		{
+			ActivateSize();
+
+			auto size = 32;
+			const auto maximum = Application::Instance().GetRenderer().GetMaximumTextureSize();
+			const auto extra = distanceField ? 2 * DistanceFieldSpread : static_cast<uint32_t>(effect);
+			auto count = 0;
+
+			while (size < maximum)
+			{
+				auto x = GlyphPadding;
+				auto y = GlyphPadding;
+				auto yb = GlyphPadding;
+				for (auto c = start; c != end; ++c)
+				{
+					if (c->second.GetImage())
+					{
+						continue;
+					}
+
+					if (FT_Load_Char(fontFace, c->first, FT_LOAD_DEFAULT | (distanceField ? FT_LOAD_NO_HINTING : FT_LOAD_FORCE_AUTOHINT)) != 0)
+					{
+						continue;
+					}
+
+					const auto glyphWidth = static_cast<int>(std::ceil(fontFace->glyph->metrics.width * FT_PosCoefficient)) + GlyphPadding + extra;
+					const auto glyphHeight = static_cast<int>(std::ceil(fontFace->glyph->metrics.height * FT_PosCoefficient)) + GlyphPadding + extra;
+
+					x += glyphWidth;
+					if (x > size)
+					{
+						x = GlyphPadding;
+						y = yb;
+					}
+					const auto yy = y + glyphHeight;
+					if (yy > size)
+					{
+						goto too_small;
+					}
+
+					if (yy > yb)
+					{
+						yb = yy;
+					}
+
+					++count;
+				}
+				break;
+
+				too_small:
+				size *= 2;
+			}
+
+			return count ? size : 0;
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::Rasterise(uint32_t startCodepoint, uint32_t endCodepoint) const
+		{
+			auto start = glyphMap.lower_bound(startCodepoint);
+			if (start == glyphMap.end())
+			{
+				return;
+			}
+
+			const auto bck = start;
+			const auto end = glyphMap.upper_bound(endCodepoint);
+
+			//cached pages must only contain their own glyphs
+			const auto cached = GlyphAtlasCache::IsEnabled();
+			Misc::AnsiString cacheKey;
+			if (cached)
+			{
+				cacheKey = GetGlyphPageKey(startCodepoint);
+				if (LoadGlyphPage(cacheKey, start, end))
+				{
+					return;
+				}
+			}
+			std::vector<std::vector<uint32_t>> pageBuffers;
+			std::vector<GlyphAtlasCache::GlyphInfo> pageGlyphs;
+			auto complete = true;
+
+			const auto loadFlags = FT_LOAD_RENDER | (distanceField ? FT_LOAD_NO_HINTING | FT_LOAD_TARGET_NORMAL : (antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO));
+			const auto extra = distanceField ? 2 * DistanceFieldSpread : static_cast<uint32_t>(effect);
+
+			while (true)
+			{
+				const auto textureSize = GetTextureSize(start, end);
+				if (textureSize == 0)
+				{
+					break;
+				}
+
+				ActivateSize();
+
+				auto texture = Application::Instance().GetRenderer().CreateTexture(SizeF(textureSize, textureSize));
+				glyphTextures.push_back(texture);
+
+				std::vector<uint32_t> buffer(textureSize * textureSize);
+				
+				auto x = GlyphPadding;
+				auto y = GlyphPadding;
+				auto yb = GlyphPadding;
+
+				bool finished = false;
+				bool forward = true;
+
+				while (start != glyphMap.end())
+				{
+					finished |= (start == end);
+					if (cached && finished)
+					{
+						break;
+					}
+
+					if (start->second.GetImage())
+					{
+						complete = false;
+					}
+					else
+					{
+						RectangleF area(0, 0, 0, 0);
+						PointF offset(0, 0);
+
+						if (FT_Load_Char(fontFace, start->first, loadFlags) != 0)
+						{
+							const auto image = std::make_shared<Image>(texture, area, offset);
+							glyphImages.push_back(image);
+							start->second.SetImage(image);
+						}
+						else
+						{
+							const auto glyphWidth = fontFace->glyph->bitmap.width + GlyphPadding + extra;
+							const auto glyphHeight = fontFace->glyph->bitmap.rows + GlyphPadding + extra;
+
+							auto next = x + glyphWidth;
+							if (next > textureSize)
+							{
+								x = GlyphPadding;
+								next = x + glyphWidth;
+								y = yb;
+							}
+
+							const auto bottom = y + glyphHeight;
+							if (bottom > textureSize)
+							{
+								break;
+							}
+
+							area = RectangleF(x, y, glyphWidth - GlyphPadding, glyphHeight - GlyphPadding);
+							offset = PointF(fontFace->glyph->metrics.horiBearingX * FT_PosCoefficient, -fontFace->glyph->metrics.horiBearingY * FT_PosCoefficient);
+
+							if (distanceField)
+							{
+								DrawDistanceFieldToBuffer(buffer.data() + (y * textureSize) + x, textureSize);
+
+								offset -= PointF(DistanceFieldSpread, DistanceFieldSpread);
+							}
+							else
+							{
+								DrawGlyphToBuffer(buffer.data() + (y * textureSize) + x, textureSize);
+							}
+
+							const auto image = std::make_shared<Image>(texture, area, offset);
+							glyphImages.push_back(image);
+							start->second.SetImage(image);
+
+							x = next;
+							if (bottom > yb)
+							{
+								yb = bottom;
+							}
+						}
+
+						if (cached)
+						{
+							if (!start->second.IsValid())
+							{
+								InitialiseFontGlyph(start);
+							}
+
+							GlyphAtlasCache::GlyphInfo info = {
+								start->first,
+								static_cast<uint32_t>(pageBuffers.size()),
+								area,
+								offset,
+								start->second.GetAdvance()
+							};
+							pageGlyphs.push_back(info);
+						}
+					}
+
+					if (forward)
+					{
+						if (++start == glyphMap.end())
+						{
+							finished = true;
+							if (cached)
+							{
+								break;
+							}
+							forward = false;
+							start = bck;
+						}
+					}
+					if (!forward)
+					{
+						if ((start == glyphMap.begin()) || (--start == glyphMap.begin()))
+						{
+							break;
+						}
+					}
+				}
+
+				if (!distanceField)
+				{
+					ApplyEffect(buffer.data(), textureSize, textureSize);
+				}
+
+				UploadGlyphTexture(texture, buffer.data(), textureSize);
+
+				if (cached)
+				{
+					pageBuffers.push_back(std::move(buffer));
+				}
+
+				if (finished)
+				{
+					break;
+				}
+			}
+
+			if (cached && complete)
+			{
+				std::vector<GlyphAtlasCache::TextureInfo> pageTextures;
+				for (auto &pageBuffer : pageBuffers)
+				{
+					GlyphAtlasCache::TextureInfo info = { static_cast<uint32_t>(std::sqrt(pageBuffer.size())), pageBuffer.data() };
+					pageTextures.push_back(info);
+				}
+
+				GlyphAtlasCache::Save(cacheKey, pageTextures, pageGlyphs);
+			}
+		}
+		//---------------------------------------------------------------------------
+		Misc::AnsiString FreeTypeFont::GetGlyphPageKey(uint32_t startCodepoint) const
+		{
+			const auto dpi = Application::Instance().GetRenderer().GetDisplayDPI();
+
+			std::stringstream ss;
+			//die Faces einer Schriftsammlung (.ttc) teilen sich die Datei und damit den Hashwert
+			ss << std::hex << std::setw(16) << std::setfill('0') << face->GetDataHash() << std::dec << '_' << face->GetFace()->face_index;
+			if (distanceField)
+			{
+				//distance fields don't depend on size, anti-aliasing, effect or dpi
+				ss << "_sdf" << DistanceFieldSize << 'x' << DistanceFieldSpread;
+			}
+			else
+			{
+				ss << '_' << static_cast<uint32_t>(pointSize * 64.0f)
+				   << '_' << (antiAliased ? 1 : 0)
+				   << '_' << static_cast<uint32_t>(effect)
+				   << '_' << static_cast<uint32_t>(dpi.X) << 'x' << static_cast<uint32_t>(dpi.Y);
+			}
+			ss << '_' << std::hex << startCodepoint;
+			return ss.str();
+		}
+		//---------------------------------------------------------------------------
+		bool FreeTypeFont::LoadGlyphPage(const Misc::AnsiString &key, CodepointIterator start, CodepointIterator end) const
+		{
+			Misc::MemoryMappedFile file;
+			std::vector<GlyphAtlasCache::TextureInfo> textures;
+			std::vector<GlyphAtlasCache::GlyphInfo> glyphs;
+			if (!GlyphAtlasCache::Load(key, file, textures, glyphs))
+			{
+				return false;
+			}
+
+			//the page has to match the glyphs of this face exactly
+			auto count = 0u;
+			for (auto it = start; it != end; ++it)
+			{
+				if (it->second.GetImage())
+				{
+					return false;
+				}
+				++count;
+			}
+			if (count != glyphs.size())
+			{
+				return false;
+			}
+			for (auto &glyph : glyphs)
+			{
+				const auto it = glyphMap.find(glyph.Codepoint);
+				if (it == glyphMap.end() || it->first < start->first || (end != glyphMap.end() && it->first >= end->first))
+				{
+					return false;
+				}
+			}
+
+			std::vector<TexturePtr> pageTextures;
+			for (auto &info : textures)
+			{
+				const SizeF size(info.Size, info.Size);
+
+				auto texture = Application::Instance().GetRenderer().CreateTexture(size);
+				UploadGlyphTexture(texture, info.Pixels, info.Size);
+				glyphTextures.push_back(texture);
+				pageTextures.push_back(texture);
+			}
+
+			for (auto &glyph : glyphs)
+			{
+				auto &fontGlyph = glyphMap.find(glyph.Codepoint)->second;
+
+				const auto image = std::make_shared<Image>(pageTextures[glyph.Texture], glyph.Area, glyph.Offset);
+				glyphImages.push_back(image);
+				fontGlyph.SetImage(image);
+
+				//advances of distance field glyphs depend on the current scaling
+				if (!fontGlyph.IsValid() && !distanceField)
+				{
+					fontGlyph.SetAdvance(glyph.Advance);
+					fontGlyph.SetValid(true);
+				}
+			}
+
+			return true;
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::DrawGlyphToBuffer(uint32_t *buffer, uint32_t width) const
+		{
+			const auto bitmap = &fontFace->glyph->bitmap;
+
+			for (auto i = 0; i < bitmap->rows; ++i)
+			{
+				auto src = bitmap->buffer + (i * bitmap->pitch);
+				switch (bitmap->pixel_mode)
+				{
+					case FT_PIXEL_MODE_GRAY:
+						{
+							auto dst = reinterpret_cast<uint8_t*>(buffer);
+							for (auto j = 0; j < bitmap->width; ++j)
+							{
+								*dst++ = 0xFF;
+								*dst++ = 0xFF;
+								*dst++ = 0xFF;
+								*dst++ = *src++;
+							}
+						}
+						break;
+					case FT_PIXEL_MODE_MONO:
+						for (auto j = 0; j < bitmap->width; ++j)
+						{
+							buffer[j] = (src[j / 8] & (0x80 >> (j & 7))) ? 0xFFFFFFFF : 0x00000000;
+						}
+						break;
+					default:
+						throw;
+				}
+
+				buffer += width;
+			}
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::DrawDistanceFieldToBuffer(uint32_t *buffer, uint32_t width) const
+		{
+			const auto bitmap = &fontFace->glyph->bitmap;
+
+			const int fieldWidth = bitmap->width + 2 * DistanceFieldSpread;
+			const int fieldHeight = bitmap->rows + 2 * DistanceFieldSpread;
+
+			//squared distances to the nearest pixel inside and outside of the glyph
+			std::vector<float> outside(fieldWidth * fieldHeight, DistanceInfinity);
+			std::vector<float> inside(fieldWidth * fieldHeight, 0.0f);
+			for (auto i = 0; i < bitmap->rows; ++i)
+			{
+				const auto src = bitmap->buffer + (i * bitmap->pitch);
+				for (auto j = 0; j < bitmap->width; ++j)
+				{
+					const auto covered = bitmap->pixel_mode == FT_PIXEL_MODE_MONO ? (src[j / 8] & (0x80 >> (j & 7))) != 0 : src[j] >= 0x80;
+					if (covered)
+					{
+						const auto index = (i + DistanceFieldSpread) * fieldWidth + j + DistanceFieldSpread;
+						outside[index] = 0.0f;
+						inside[index] = DistanceInfinity;
+					}
+				}
+			}
+
+			DistanceTransform(outside, fieldWidth, fieldHeight);
+			DistanceTransform(inside, fieldWidth, fieldHeight);
+
+			for (auto i = 0; i < fieldHeight; ++i)
+			{
+				for (auto j = 0; j < fieldWidth; ++j)
+				{
+					const auto index = i * fieldWidth + j;
+
+					//the edge lies between the pixel centers
+					auto distance = std::sqrt(outside[index]) - std::sqrt(inside[index]);
+					distance += distance > 0.0f ? -0.5f : 0.5f;
+
+					const auto value = std::min(std::max(0.5f - distance / (2.0f * DistanceFieldSpread), 0.0f), 1.0f);
+
+					buffer[j] = (static_cast<uint32_t>(value * 255.0f + 0.5f) << 24) | 0x00FFFFFF;
+				}
+
+				buffer += width;
+			}
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::UploadGlyphTexture(const TexturePtr &texture, const uint32_t *buffer, uint32_t size) const
+		{
+			const SizeF textureSize(size, size);
+
+			if (!distanceField)
+			{
+				texture->LoadFromMemory(buffer, textureSize, Texture::PixelFormat::RGBA);
+				return;
+			}
+
+			if (texture->IsPixelFormatSupported(Texture::PixelFormat::RGBA_DISTANCE_FIELD))
+			{
+				texture->LoadFromMemory(buffer, textureSize, Texture::PixelFormat::RGBA_DISTANCE_FIELD);
+				return;
+			}
+
+			//the renderer can't evaluate distance fields, threshold them here
+			const auto band = 1.0f / (2.0f * DistanceFieldSpread);
+
+			std::vector<uint32_t> coverage(size * size);
+			for (auto i = 0u; i < coverage.size(); ++i)
+			{
+				const auto value = (buffer[i] >> 24) / 255.0f;
+
+				auto t = std::min(std::max((value - (0.5f - band)) / (2.0f * band), 0.0f), 1.0f);
+				t = t * t * (3.0f - 2.0f * t);
+
+				coverage[i] = (static_cast<uint32_t>(t * 255.0f + 0.5f) << 24) | 0x00FFFFFF;
+			}
+
+			texture->LoadFromMemory(coverage.data(), textureSize, Texture::PixelFormat::RGBA);
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::Free()
+		{
+			if (!fontSize)
+			{
+				return;
+			}
+
+			glyphMap.clear();
+			glyphImages.clear();
+			glyphTextures.clear();
+
+			FT_Done_Size(fontSize);
+			fontSize = nullptr;
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::ActivateSize() const
+		{
+			if (fontFace->size != fontSize)
+			{
+				FT_Activate_Size(fontSize);
+			}
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::UpdateFont()
+		{
+			if (distanceField && fontSize)
+			{
+				//distance fields are independent of size and dpi, only the metrics change
+				UpdateMetrics();
+
+				return;
+			}
+
+			Free();
+
+			if (FT_New_Size(fontFace, &fontSize) != 0)
+			{
+				fontSize = nullptr;
+
+				throw Misc::Exception();
+			}
+
+			SetCharacterSize();
+
+			UpdateMetrics();
+
+			InitialiseGlyphMap();
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::OnDisplaySizeChanged()
+		{
+			//only the dpi affects the rasterised glyphs
+			if (!fontSize || Application::Instance().GetRenderer().GetDisplayDPI() == displayDPI)
+			{
+				return;
+			}
+
+			if (distanceField)
+			{
+				displayDPI = Application::Instance().GetRenderer().GetDisplayDPI();
+
+				UpdateMetrics();
+
+				return;
+			}
+
+			//keep the glyph map, the pages are rasterised again when they are requested
+			glyphImages.clear();
+			glyphTextures.clear();
+			for (auto &glyph : glyphMap)
+			{
+				glyph.second = FontGlyph();
+			}
+			SetMaxCodepoint(maximumCodepoint);
+
+			SetCharacterSize();
+
+			UpdateMetrics();
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::SetCharacterSize()
+		{
+			ActivateSize();
+
+			displayDPI = Application::Instance().GetRenderer().GetDisplayDPI();
+
+			if (distanceField)
+			{
+				if (FT_Set_Pixel_Sizes(fontFace, 0, DistanceFieldSize) != 0)
+				{
+					throw Misc::Exception();
+				}
+			}
+			else
+			{
+				const auto dpiHorizontal = static_cast<uint32_t>(displayDPI.X);
+				const auto dpiVertical = static_cast<uint32_t>(displayDPI.Y);
+
+				const auto hps = pointSize * 64.0f;
+				const auto vps = pointSize * 64.0f;
+
+				if (FT_Set_Char_Size(fontFace, FT_F26Dot6(hps), FT_F26Dot6(vps), dpiHorizontal, dpiVertical) != 0)
+				{
+					const auto ptSize72 = (pointSize * 72.0f) / dpiVertical;
+					auto bestDelta = 99999.0f;
+					auto bestSize = 0.0f;
+					for (int i = 0; i < fontFace->num_fixed_sizes; i++)
+					{
+						const auto size = fontFace->available_sizes[i].size * FT_PosCoefficient;
+						const auto delta = std::abs(size - ptSize72);
+						if (delta < bestDelta)
+						{
+							bestDelta = delta;
+							bestSize = size;
+						}
+					}
+
+					if (bestSize <= 0.0f || FT_Set_Char_Size(fontFace, 0, FT_F26Dot6(bestSize * 64), 0, 0) != 0)
+					{
+						throw Misc::Exception();
+					}
+				}
+			}
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::UpdateMetrics()
+		{
+			ActivateSize();
+
+			auto scale = 1.0f;
+			if (distanceField)
+			{
+				const auto dpiVertical = Application::Instance().GetRenderer().GetDisplayDPI().Y;
+
+				scale = (pointSize * dpiVertical / 72.0f) / DistanceFieldSize;
+				if (scale != scalingVertical)
+				{
+					//the advances have to be calculated for the new scaling
+					for (auto &glyph : glyphMap)
+					{
+						glyph.second.SetValid(false);
+					}
+				}
+			}
+			scalingHorizontal = scalingVertical = scale;
+
+			if (fontFace->face_flags & FT_FACE_FLAG_SCALABLE)
+			{
+				const auto scaleY = fontFace->size->metrics.y_scale * FT_PosCoefficient * (1.0f / 65536.0f);
+				ascender = fontFace->ascender * scaleY * scale;
+				descender = fontFace->descender * scaleY * scale;
+				height = fontFace->height * scaleY * scale;
+			}
+			else
+			{
+				ascender = fontFace->size->metrics.ascender * FT_PosCoefficient * scale;
+				descender = fontFace->size->metrics.descender * FT_PosCoefficient * scale;
+				height = fontFace->size->metrics.height * FT_PosCoefficient * scale;
+			}
+
+			if (lineSpacing > 0.0f)
+			{
+				height = lineSpacing;
+			}
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::InitialiseGlyphMap()
+		{
+			FT_UInt index;
+			auto codepoint = FT_Get_First_Char(fontFace, &index);
+			auto maximum = codepoint;
+
+			while (index)
+			{
+				if (maximum < codepoint)
+				{
+					maximum = codepoint;
+				}
+
+				glyphMap[codepoint] = FontGlyph();
+
+				codepoint = FT_Get_Next_Char(fontFace, codepoint, &index);
+			}
+
+			SetMaxCodepoint(maximum);
+		}
+		//---------------------------------------------------------------------------
+		void FreeTypeFont::InitialiseFontGlyph(CodepointIterator it) const
+		{
+			ActivateSize();
+
+			if (FT_Load_Char(fontFace, it->first, FT_LOAD_DEFAULT | (distanceField ? FT_LOAD_NO_HINTING : 0)) != 0)
+			{
+				return;
+			}
+
+			const auto advance = fontFace->glyph->metrics.horiAdvance * FT_PosCoefficient * scalingHorizontal;
+
+			it->second.SetAdvance(advance);
+			it->second.SetValid(true);
+		}
+		//---------------------------------------------------------------------------
+	}
+}
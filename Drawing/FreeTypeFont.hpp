@@ -1,161 +1,209 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_DRAWING_FREETYPEFONT_HPP
-#define OSHGUI_DRAWING_FREETYPEFONT_HPP
-
-#include "Font.hpp"
-#include "../Misc/RawDataContainer.hpp"
-#include "Image.hpp"
-
-#include <vector>
-
-typedef struct FT_FaceRec_*  FT_Face;
-
-#undef DrawText
-
-namespace OSHGui
-{
-	namespace Drawing
-	{
-		/*!
-		\brief
-			Implementation of the Font class interface using the FreeType library.
-
-			This implementation tries to provide maximal support for any kind of
-			fonts supported by FreeType. It has been tested on outline font formats
-			like TTF and PS as well as on bitmap font formats like PCF and FON.
-
-			Glyphs are rendered dynamically on demand, so a large font with lots
-			of glyphs won't slow application startup time.
-		*/
-		class OSHGUI_EXPORT FreeTypeFont : public Font
-		{
-		public:
-			/*!
-			\brief
-				Constructor for FreeTypeFont based fonts.
-
-			\param font_name
-				The name that the font will use within the CEGUI system.
-
-			\param point_size
-				Specifies the point size that the font is to be rendered at.
-
-			\param anti_aliased
-				Specifies whether the font should be rendered using anti aliasing.
-
-			\param font_filename
-				The filename of an font file that will be used as the source for
-				glyph images for this font.
-
-			\param resource_group
-				The resource group identifier to use when loading the font file
-				specified by \a font_filename.
-
-			\param auto_scaled
-				Specifies whether the font imagery should be automatically scaled to
-				maintain the same physical size (which is calculated by using the
-				native resolution setting).
-
-			\param native_horz_res
-				The horizontal native resolution value.  This is only significant when
-				auto scaling is enabled.
-
-			\param native_vert_res
-				The vertical native resolution value.  This is only significant when
-				auto scaling is enabled.
-
-			\param specific_line_spacing
-				If specified (non-zero), this will be the line spacing that we will
-				report for this font, regardless of what is mentioned in the font file
-				itself.
-			*/
-			FreeTypeFont(const Misc::AnsiString &filename, const float pointSize, const bool antiAliased, const Effect effect, const float lineSpacing = 0.0f);
-
-			FreeTypeFont(Misc::RawDataContainer data, const float pointSize, const bool antiAliased, const Effect effect, const float lineSpacing = 0.0f);
-
-			//! Destructor.
-			~FreeTypeFont();
-
-			//! return the point size of the freetype font.
-			float GetPointSize() const;
-
-			//! return whether the freetype font is rendered anti-aliased.
-			bool IsAntiAliased() const;
-
-			//! return the point size of the freetype font.
-			void SetPointSize(const float pointSize);
-
-			//! return whether the freetype font is rendered anti-aliased.
-			void SetAntiAliased(const bool antiAliased);
-
-		protected:
-			/*!
-			\brief
-				Copy the current glyph data into \a buffer, which has a width of
-				\a buf_width pixels (not bytes).
-
-			\param buffer
-				Memory buffer large enough to receive the imagery for the currently
-				loaded glyph.
-
-			\param buf_width
-				Width of \a buffer in pixels (where each pixel is a argb_t).
-
-			\return
-				Nothing.
-			*/
-			void DrawGlyphToBuffer(uint32_t *buffer, uint32_t width) const;
-
-			/*!
-			\brief
-				Return the required texture size required to store imagery for the
-				glyphs from s to e
-			\param s
-				The first glyph in set
-			\param e
-				The last glyph in set
-			*/
-			unsigned int GetTextureSize(CodepointIterator start, CodepointIterator end) const;
-
-			//! Free all allocated font data.
-			void Free();
-
-			//! initialise FontGlyph for given codepoint.
-			void InitialiseFontGlyph(CodepointIterator cp) const;
-
-			void InitialiseGlyphMap();
-
-			// overrides of functions in Font base class.
-			virtual const FontGlyph* FindFontGlyph(const uint32_t codepoint) const override;
-			virtual void Rasterise(uint32_t start_codepoint, uint32_t end_codepoint) const override;
-			virtual void UpdateFont() override;
-
-			//! If non-zero, the overridden line spacing that we're to report.
-			float lineSpacing;
-			//! Point size of font.
-			float pointSize;
-			//! True if the font should be rendered as anti-alaised by freeType.
-			bool antiAliased;
-			//! FreeType-specific font handle
-			FT_Face fontFace;
-			//! Font file data
-			Misc::RawDataContainer data;
-			//! Type definition for TextureVector.
-			typedef std::vector<TexturePtr> TextureVector;
-			//! Textures that hold the glyph imagery for this font.
-			mutable TextureVector glyphTextures;
-			typedef std::vector<ImagePtr> ImageVector;
-			//! collection of images defined for this font.
-			mutable ImageVector glyphImages;
-		};
-	}
-}
-
-#endif
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_DRAWING_FREETYPEFONT_HPP
+#define OSHGUI_DRAWING_FREETYPEFONT_HPP
+
+#include "Font.hpp"
+#include "FreeTypeFace.hpp"
+#include "../Misc/RawDataContainer.hpp"
+#include "Image.hpp"
+
+#include <vector>
+
+typedef struct FT_FaceRec_*  FT_Face;
+typedef struct FT_SizeRec_*  FT_Size;
+
+#undef DrawText
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		/*!
+		\brief
+			Implementation of the Font class interface using the FreeType library.
+
+			This implementation tries to provide maximal support for any kind of
+			fonts supported by FreeType. It has been tested on outline font formats
+			like TTF and PS as well as on bitmap font formats like PCF and FON.
+
+			Glyphs are rendered dynamically on demand, so a large font with lots
+			of glyphs won't slow application startup time.
+		*/
+		class OSHGUI_EXPORT FreeTypeFont : public Font
+		{
+		public:
+			/*!
+			\brief
+				Constructor for FreeTypeFont based fonts.
+
+			\param font_name
+				The name that the font will use within the CEGUI system.
+
+			\param point_size
+				Specifies the point size that the font is to be rendered at.
+
+			\param anti_aliased
+				Specifies whether the font should be rendered using anti aliasing.
+
+			\param font_filename
+				The filename of an font file that will be used as the source for
+				glyph images for this font.
+
+			\param resource_group
+				The resource group identifier to use when loading the font file
+				specified by \a font_filename.
+
+			\param auto_scaled
+				Specifies whether the font imagery should be automatically scaled to
+				maintain the same physical size (which is calculated by using the
+				native resolution setting).
+
+			\param native_horz_res
+				The horizontal native resolution value.  This is only significant when
+				auto scaling is enabled.
+
+			\param native_vert_res
+				The vertical native resolution value.  This is only significant when
+				auto scaling is enabled.
+
+			\param specific_line_spacing
+				If specified (non-zero), this will be the line spacing that we will
+				report for this font, regardless of what is mentioned in the font file
+				itself.
+
+			\param distanceField
+				Specifies whether the glyphs are rasterised once as signed distance
+				fields. Such a font can be scaled without re-rasterising its glyphs.
+				Effects are not applied to distance fields.
+			*/
+			FreeTypeFont(const Misc::AnsiString &filename, const float pointSize, const bool antiAliased, const Effect effect, const float lineSpacing = 0.0f, const bool distanceField = false);
+
+			FreeTypeFont(Misc::RawDataContainer data, const float pointSize, const bool antiAliased, const Effect effect, const float lineSpacing = 0.0f, const bool distanceField = false);
+
+			FreeTypeFont(std::shared_ptr<FreeTypeFace> face, const float pointSize, const bool antiAliased, const Effect effect, const float lineSpacing = 0.0f, const bool distanceField = false);
+
+			//! Destructor.
+			~FreeTypeFont();
+
+			//! return the point size of the freetype font.
+			float GetPointSize() const;
+
+			//! return whether the freetype font is rendered anti-aliased.
+			bool IsAntiAliased() const;
+
+			//! return the point size of the freetype font.
+			void SetPointSize(const float pointSize);
+
+			//! return whether the freetype font is rendered anti-aliased.
+			void SetAntiAliased(const bool antiAliased);
+
+			//! return whether the glyphs of the freetype font are rendered as distance fields.
+			bool IsDistanceField() const;
+
+			//! set whether the glyphs of the freetype font are rendered as distance fields.
+			void SetDistanceField(const bool distanceField);
+
+		protected:
+			/*!
+			\brief
+				Copy the current glyph data into \a buffer, which has a width of
+				\a buf_width pixels (not bytes).
+
+			\param buffer
+				Memory buffer large enough to receive the imagery for the currently
+				loaded glyph.
+
+			\param buf_width
+				Width of \a buffer in pixels (where each pixel is a argb_t).
+
+			\return
+				Nothing.
+			*/
+			void DrawGlyphToBuffer(uint32_t *buffer, uint32_t width) const;
+
+			/*!
+			\brief
+				Copy the signed distance field of the current glyph into \a buffer,
+				which has a width of \a width pixels. The field is padded by the
+				distance field spread on every side.
+			*/
+			void DrawDistanceFieldToBuffer(uint32_t *buffer, uint32_t width) const;
+
+			//! upload the glyph imagery in \a buffer to \a texture.
+			void UploadGlyphTexture(const TexturePtr &texture, const uint32_t *buffer, uint32_t size) const;
+
+			/*!
+			\brief
+				Return the required texture size required to store imagery for the
+				glyphs from s to e
+			\param s
+				The first glyph in set
+			\param e
+				The last glyph in set
+			*/
+			unsigned int GetTextureSize(CodepointIterator start, CodepointIterator end) const;
+
+			//! Free all allocated font data.
+			void Free();
+
+			//! make the FT_Size of this font the active size of the shared face.
+			void ActivateSize() const;
+
+			//! set the character size of the FT_Size of this font for the current dpi.
+			void SetCharacterSize();
+
+			//! update ascender, descender, height and scaling for the current size.
+			void UpdateMetrics();
+
+			//! initialise FontGlyph for given codepoint.
+			void InitialiseFontGlyph(CodepointIterator cp) const;
+
+			void InitialiseGlyphMap();
+
+			//! return the key of the glyph page starting at \a startCodepoint in the GlyphAtlasCache.
+			Misc::AnsiString GetGlyphPageKey(uint32_t startCodepoint) const;
+
+			//! try to load the glyphs from \a start to \a end from the GlyphAtlasCache.
+			bool LoadGlyphPage(const Misc::AnsiString &key, CodepointIterator start, CodepointIterator end) const;
+
+			// overrides of functions in Font base class.
+			virtual const FontGlyph* FindFontGlyph(const uint32_t codepoint) const override;
+			virtual void Rasterise(uint32_t start_codepoint, uint32_t end_codepoint) const override;
+			virtual void UpdateFont() override;
+			virtual void OnDisplaySizeChanged() override;
+
+			//! If non-zero, the overridden line spacing that we're to report.
+			float lineSpacing;
+			//! Point size of font.
+			float pointSize;
+			//! True if the font should be rendered as anti-alaised by freeType.
+			bool antiAliased;
+			//! True if the glyphs are rendered as signed distance fields.
+			bool distanceField;
+			//! Shared font file data and FreeType face
+			std::shared_ptr<FreeTypeFace> face;
+			//! FreeType-specific font handle (owned by \a face)
+			FT_Face fontFace;
+			//! FreeType size object of this font
+			FT_Size fontSize;
+			//! dpi the glyphs were rasterised for
+			PointF displayDPI;
+			//! Type definition for TextureVector.
+			typedef std::vector<TexturePtr> TextureVector;
+			//! Textures that hold the glyph imagery for this font.
+			mutable TextureVector glyphTextures;
+			typedef std::vector<ImagePtr> ImageVector;
+			//! collection of images defined for this font.
+			mutable ImageVector glyphImages;
+		};
+	}
+}
+
+#endif
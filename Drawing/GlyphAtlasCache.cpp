@@ -0,0 +1,211 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "GlyphAtlasCache.hpp"
+#include "../Application.hpp"
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		//---------------------------------------------------------------------------
+		//static attributes
+		//---------------------------------------------------------------------------
+		Misc::AnsiString GlyphAtlasCache::directory;
+		//---------------------------------------------------------------------------
+		namespace
+		{
+			const uint32_t Magic = 0x4147534F; //OSGA
+			const uint32_t Version = 1;
+
+			struct StoredGlyph
+			{
+				uint32_t Codepoint;
+				uint32_t Texture;
+				float Area[4];
+				float Offset[2];
+				float Advance;
+			};
+			//---------------------------------------------------------------------------
+			template<typename T>
+			bool Read(const Misc::MemoryMappedFile &file, size_t &position, T &value)
+			{
+				if (sizeof(T) > file.GetSize() - position)
+				{
+					return false;
+				}
+				std::memcpy(&value, file.GetDataPointer() + position, sizeof(T));
+				position += sizeof(T);
+				return true;
+			}
+			//---------------------------------------------------------------------------
+			template<typename T>
+			void Write(std::ofstream &out, const T &value)
+			{
+				out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+			}
+		}
+		//---------------------------------------------------------------------------
+		//Getter/Setter
+		//---------------------------------------------------------------------------
+		void GlyphAtlasCache::SetDirectory(const Misc::AnsiString &_directory)
+		{
+			directory = _directory;
+		}
+		//---------------------------------------------------------------------------
+		const Misc::AnsiString& GlyphAtlasCache::GetDirectory()
+		{
+			return directory;
+		}
+		//---------------------------------------------------------------------------
+		bool GlyphAtlasCache::IsEnabled()
+		{
+			return !directory.empty();
+		}
+		//---------------------------------------------------------------------------
+		Misc::AnsiString GlyphAtlasCache::GetPath(const Misc::AnsiString &key)
+		{
+			auto path = directory;
+			if (path.back() != '/' && path.back() != '\\')
+			{
+				path += '/';
+			}
+			return path + key + ".glyphs";
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		bool GlyphAtlasCache::Load(const Misc::AnsiString &key, Misc::MemoryMappedFile &file, std::vector<TextureInfo> &textures, std::vector<GlyphInfo> &glyphs)
+		{
+			if (!IsEnabled() || !file.Open(GetPath(key)))
+			{
+				return false;
+			}
+
+			textures.clear();
+			glyphs.clear();
+
+			size_t position = 0;
+			uint32_t magic, version, textureCount;
+			if (!Read(file, position, magic) || magic != Magic || !Read(file, position, version) || version != Version || !Read(file, position, textureCount))
+			{
+				file.Close();
+				return false;
+			}
+
+			//größere Texturen könnte der Renderer nicht anlegen, außerdem kann die Größe so nicht überlaufen
+			const auto maximumSize = Application::Instance().GetRenderer().GetMaximumTextureSize();
+
+			for (auto i = 0u; i < textureCount; ++i)
+			{
+				TextureInfo texture;
+				if (!Read(file, position, texture.Size) || texture.Size > maximumSize)
+				{
+					file.Close();
+					return false;
+				}
+
+				const auto bytes = static_cast<size_t>(texture.Size) * texture.Size * sizeof(uint32_t);
+				if (bytes > file.GetSize() - position)
+				{
+					file.Close();
+					return false;
+				}
+				texture.Pixels = reinterpret_cast<const uint32_t*>(file.GetDataPointer() + position);
+				position += bytes;
+
+				textures.push_back(texture);
+			}
+
+			uint32_t glyphCount;
+			if (!Read(file, position, glyphCount) || glyphCount > (file.GetSize() - position) / sizeof(StoredGlyph))
+			{
+				file.Close();
+				return false;
+			}
+
+			glyphs.reserve(glyphCount);
+			for (auto i = 0u; i < glyphCount; ++i)
+			{
+				StoredGlyph stored;
+				if (!Read(file, position, stored) || stored.Texture >= textureCount)
+				{
+					file.Close();
+					return false;
+				}
+
+				GlyphInfo glyph = {
+					stored.Codepoint,
+					stored.Texture,
+					RectangleF(stored.Area[0], stored.Area[1], stored.Area[2], stored.Area[3]),
+					PointF(stored.Offset[0], stored.Offset[1]),
+					stored.Advance
+				};
+				glyphs.push_back(glyph);
+			}
+
+			return true;
+		}
+		//---------------------------------------------------------------------------
+		void GlyphAtlasCache::Save(const Misc::AnsiString &key, const std::vector<TextureInfo> &textures, const std::vector<GlyphInfo> &glyphs)
+		{
+			if (!IsEnabled())
+			{
+				return;
+			}
+
+			const auto path = GetPath(key);
+			const auto temporaryPath = path + ".tmp";
+
+			{
+				std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+				if (!out)
+				{
+					return;
+				}
+
+				Write(out, Magic);
+				Write(out, Version);
+				Write(out, static_cast<uint32_t>(textures.size()));
+				for (auto &texture : textures)
+				{
+					Write(out, texture.Size);
+					out.write(reinterpret_cast<const char*>(texture.Pixels), static_cast<std::streamsize>(texture.Size) * texture.Size * sizeof(uint32_t));
+				}
+
+				Write(out, static_cast<uint32_t>(glyphs.size()));
+				for (auto &glyph : glyphs)
+				{
+					StoredGlyph stored = {
+						glyph.Codepoint,
+						glyph.Texture,
+						{ glyph.Area.GetLeft(), glyph.Area.GetTop(), glyph.Area.GetWidth(), glyph.Area.GetHeight() },
+						{ glyph.Offset.X, glyph.Offset.Y },
+						glyph.Advance
+					};
+					Write(out, stored);
+				}
+
+				if (!out)
+				{
+					out.close();
+					std::remove(temporaryPath.c_str());
+					return;
+				}
+			}
+
+			//readers never see a partially written page
+			std::remove(path.c_str());
+			std::rename(temporaryPath.c_str(), path.c_str());
+		}
+		//---------------------------------------------------------------------------
+	}
+}
@@ -0,0 +1,102 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_DRAWING_GLYPHATLASCACHE_HPP
+#define OSHGUI_DRAWING_GLYPHATLASCACHE_HPP
+
+#include <vector>
+#include <cstdint>
+#include "../Exports.hpp"
+#include "../Misc/Strings.hpp"
+#include "../Misc/MemoryMappedFile.hpp"
+#include "Rectangle.hpp"
+#include "Point.hpp"
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		/**
+		 * Speichert fertig gerasterte Glyphseiten (Texturen inklusive Effekt und Metriken) auf der Festplatte.
+		 *
+		 * Der Cache ist standardmäßig deaktiviert und wird durch SetDirectory aktiviert. Gespeicherte Seiten
+		 * werden beim Laden in den Speicher eingeblendet und direkt als Textur hochgeladen.
+		 */
+		class OSHGUI_EXPORT GlyphAtlasCache
+		{
+		public:
+			/**
+			 * Ein Glyph in einer gespeicherten Seite.
+			 */
+			struct GlyphInfo
+			{
+				uint32_t Codepoint;
+				uint32_t Texture;
+				RectangleF Area;
+				PointF Offset;
+				float Advance;
+			};
+
+			/**
+			 * Eine Textur in einer gespeicherten Seite (RGBA, quadratisch).
+			 */
+			struct TextureInfo
+			{
+				uint32_t Size;
+				const uint32_t *Pixels;
+			};
+
+			/**
+			 * Legt das Verzeichnis fest, in dem die Glyphseiten gespeichert werden.
+			 * Ein leerer Pfad deaktiviert den Cache.
+			 *
+			 * \param directory
+			 */
+			static void SetDirectory(const Misc::AnsiString &directory);
+			/**
+			 * Ruft das Verzeichnis ab, in dem die Glyphseiten gespeichert werden.
+			 *
+			 * \return directory
+			 */
+			static const Misc::AnsiString& GetDirectory();
+			/**
+			 * Ruft ab, ob der Cache aktiviert ist.
+			 *
+			 * \return true, falls ein Verzeichnis festgelegt ist
+			 */
+			static bool IsEnabled();
+
+			/**
+			 * Lädt eine gespeicherte Glyphseite. Die Pixel der Texturen verweisen in \a file
+			 * und bleiben gültig, solange \a file geöffnet ist.
+			 *
+			 * \param key Schlüssel der Seite
+			 * \param file nimmt die eingeblendete Datei auf
+			 * \param textures nimmt die Texturen auf
+			 * \param glyphs nimmt die Glyphen auf
+			 * \return false, falls die Seite nicht im Cache liegt oder ungültig ist
+			 */
+			static bool Load(const Misc::AnsiString &key, Misc::MemoryMappedFile &file, std::vector<TextureInfo> &textures, std::vector<GlyphInfo> &glyphs);
+			/**
+			 * Speichert eine Glyphseite.
+			 *
+			 * \param key Schlüssel der Seite
+			 * \param textures die Texturen der Seite
+			 * \param glyphs die Glyphen der Seite
+			 */
+			static void Save(const Misc::AnsiString &key, const std::vector<TextureInfo> &textures, const std::vector<GlyphInfo> &glyphs);
+
+		private:
+			static Misc::AnsiString GetPath(const Misc::AnsiString &key);
+
+			static Misc::AnsiString directory;
+		};
+	}
+}
+
+#endif
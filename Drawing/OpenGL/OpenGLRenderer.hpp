@@ -1,105 +1,136 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_DRAWING_OPENGLRENDERER_HPP
-#define OSHGUI_DRAWING_OPENGLRENDERER_HPP
-
-#include "../Renderer.hpp"
-
-#include "GL.hpp"
-#include <vector>
-#include <map>
-
-namespace OSHGui
-{
-	namespace Drawing
-	{
-		class OpenGLTexture;
-		class OpenGLTextureTarget;
-		class OpenGLGeometryBuffer;
-
-		/**
-		 * Die OpenGL Variante des Renderer.
-		 */
-		class OSHGUI_EXPORT OpenGLRenderer : public Renderer
-		{
-		public:
-			/**
-			 * Konstruktor der Klasse.
-			 */
-			OpenGLRenderer();
-			~OpenGLRenderer();
-
-			/**
-			 * Hilfsfunktion, die vor einem Reset aufgerufen werden muss.
-			 */
-			void PreReset();
-			/**
-			 * Hilfsfunktion, die nach einem Reset aufgerufen werden muss.
-			 */
-			void PostReset();
-
-			/**
-			 * Rechnet die Gre in eine untersttzt Gre um.
-			 *
-			 * \param size
-			 * \return umgewandelte Gre
-			 */
-			SizeF GetAdjustedSize(const SizeF &size);
-
-			virtual RenderTargetPtr& GetDefaultRenderTarget() override;
-			virtual GeometryBufferPtr CreateGeometryBuffer() override;
-			virtual TextureTargetPtr CreateTextureTarget() override;
-			virtual TexturePtr CreateTexture() override;
-			virtual TexturePtr CreateTexture(const Misc::AnsiString &filename) override;
-			virtual TexturePtr CreateTexture(const SizeF &size) override;
-
-			virtual void BeginRendering() override;
-			virtual void EndRendering() override;
-			virtual void SetDisplaySize(const SizeF &sz) override;
-			virtual const SizeF& GetDisplaySize() const override;
-			virtual const PointF& GetDisplayDPI() const override;
-			virtual uint32_t GetMaximumTextureSize() const override;
-
-		private:
-			/**
-			 * Ruft die Gre des Viewport ab.
-			 *
-			 * \return Gre des Viewport
-			 */
-			SizeF GetViewportSize();
-			/**
-			 * Berechnet die nchste Zweierpotenz, falss \a size keine Zweierpotenz ist.
-			 *
-			 * \param size
-			 * \return nchste Zweierpotenz
-			 */
-			float GetSizeNextPOT(float size) const;
-
-			/**
-			 * Entfernt ungltige Referenzen zu Objekten, fr die ein Reset ausgefhrt werden muss.
-			 */
-			void RemoveWeakReferences();
-
-			SizeF displaySize;
-			PointF displayDPI;
-			
-			RenderTargetPtr defaultTarget;
-			
-			typedef std::vector<std::weak_ptr<OpenGLTextureTarget>> TextureTargetList;
-			TextureTargetList textureTargets;
-			
-			typedef std::vector<std::weak_ptr<OpenGLTexture>> TextureList;
-			TextureList textures;
-			
-			uint32_t maxTextureSize;
-		};
-	}
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_DRAWING_OPENGLRENDERER_HPP
+#define OSHGUI_DRAWING_OPENGLRENDERER_HPP
+
+#include "../Renderer.hpp"
+#include "../Rectangle.hpp"
+
+#include "GL.hpp"
+#include <vector>
+#include <map>
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		class OpenGLTexture;
+		class OpenGLTextureTarget;
+		class OpenGLGeometryBuffer;
+
+		/**
+		 * Die OpenGL Variante des Renderer.
+		 */
+		class OSHGUI_EXPORT OpenGLRenderer : public Renderer
+		{
+		public:
+			/**
+			 * Konstruktor der Klasse.
+			 */
+			OpenGLRenderer();
+			~OpenGLRenderer();
+
+			/**
+			 * Hilfsfunktion, die vor einem Reset aufgerufen werden muss.
+			 */
+			void PreReset();
+			/**
+			 * Hilfsfunktion, die nach einem Reset aufgerufen werden muss.
+			 */
+			void PostReset();
+
+			/**
+			 * Rechnet die Größe in eine unterstützt Größe um.
+			 *
+			 * \param size
+			 * \return umgewandelte Größe
+			 */
+			SizeF GetAdjustedSize(const SizeF &size);
+
+			/**
+			 * Ruft das Shaderprogramm ab, mit dem Distanzfeld-Texturen gezeichnet werden.
+			 *
+			 * \return das Programm oder 0, falls keine Shader unterstützt werden
+			 */
+			GLuint GetDistanceFieldProgram() const;
+
+			/**
+			 * Setzt den Scissor-Test, falls er sich vom zuletzt gesetzten unterscheidet. Aufeinanderfolgende
+			 * GeometryBuffer mit derselben Clipping Region ändern den Zustand so nur einmal.
+			 *
+			 * \param clip die Clipping Region oder nullptr, um den Scissor-Test zu deaktivieren
+			 */
+			void SetScissorRect(const RectangleF *clip);
+
+			virtual RenderTargetPtr& GetDefaultRenderTarget() override;
+			virtual GeometryBufferPtr CreateGeometryBuffer() override;
+			virtual TextureTargetPtr CreateTextureTarget() override;
+			virtual TexturePtr CreateTexture() override;
+			virtual TexturePtr CreateTexture(const Misc::AnsiString &filename) override;
+			virtual TexturePtr CreateTexture(const SizeF &size) override;
+
+			virtual void BeginRendering() override;
+			virtual void EndRendering() override;
+			virtual void SetDisplaySize(const SizeF &sz) override;
+			virtual const SizeF& GetDisplaySize() const override;
+			virtual const PointF& GetDisplayDPI() const override;
+			virtual uint32_t GetMaximumTextureSize() const override;
+
+		private:
+			/**
+			 * Ruft die Größe des Viewport ab.
+			 *
+			 * \return Größe des Viewport
+			 */
+			SizeF GetViewportSize();
+			/**
+			 * Berechnet die nächste Zweierpotenz, falss \a size keine Zweierpotenz ist.
+			 *
+			 * \param size
+			 * \return nächste Zweierpotenz
+			 */
+			float GetSizeNextPOT(float size) const;
+
+			/**
+			 * Entfernt ungültige Referenzen zu Objekten, für die ein Reset ausgeführt werden muss.
+			 */
+			void RemoveWeakReferences();
+
+			/**
+			 * Erzeugt das Shaderprogramm für Distanzfeld-Texturen, falls GLSL unterstützt wird.
+			 */
+			void CreateDistanceFieldProgram();
+			/**
+			 * Gibt das Shaderprogramm für Distanzfeld-Texturen frei.
+			 */
+			void DestroyDistanceFieldProgram();
+
+			SizeF displaySize;
+			PointF displayDPI;
+			
+			RenderTargetPtr defaultTarget;
+			
+			typedef std::vector<std::weak_ptr<OpenGLTextureTarget>> TextureTargetList;
+			TextureTargetList textureTargets;
+			
+			typedef std::vector<std::weak_ptr<OpenGLTexture>> TextureList;
+			TextureList textures;
+			
+			uint32_t maxTextureSize;
+
+			GLuint distanceFieldProgram;
+
+			RectangleF scissorRect;
+			bool scissorEnabled;
+			bool scissorRectValid;
+		};
+	}
+}
+
 #endif
\ No newline at end of file
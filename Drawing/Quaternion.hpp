@@ -76,9 +76,9 @@ namespace OSHGui
 			}
 
 			/**
-			 * Berechnet die Lnge des Quaternion.
+			 * Berechnet die Länge des Quaternion.
 			 *
-			 * \return Lnge
+			 * \return Länge
 			 */
 			inline float Length() const
 			{
@@ -1,45 +1,50 @@
-#pragma once
-
-#include <map>
-
-#include "../Exports.hpp"
-
-#include "../Controls/Types.hpp"
-
-#include "Color.hpp"
-
-namespace OSHGui
-{
-	namespace Drawing
-	{
-		class OSHGUI_EXPORT Style
-		{
-		public:
-			struct ControlStyle
-			{
-				Color ForeColor;
-				Color BackColor;
-			};
-
-			ControlStyle DefaultColor;
-
-			/**
-			 * Legt das Farbschema fr eine Control Klasse fest.
-			 *
-			 * \param type
-			 * \param style
-			 */
-			void SetControlStyle(ControlType type, ControlStyle &&style);
-			/**
-			 * Ruft das Farbschema fr eine Control Klasse ab.
-			 *
-			 * \param controlClass
-			 * \return style
-			 */
-			const ControlStyle& GetControlStyle(ControlType type) const;
-
-		private:
-			std::map<ControlType, ControlStyle> controlStyles;
-		};
-	}
-}
+#pragma once
+
+#include <map>
+
+#include "../Exports.hpp"
+
+#include "../Controls/Types.hpp"
+
+#include "Color.hpp"
+#include "Font.hpp"
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		class OSHGUI_EXPORT Style
+		{
+		public:
+			struct ControlStyle
+			{
+				Color ForeColor;
+				Color BackColor;
+				/**
+				 * Schriftart der Control Klasse. nullptr behält die Schriftart des Controls bei.
+				 */
+				FontPtr Font;
+			};
+
+			ControlStyle DefaultColor;
+
+			/**
+			 * Legt das Farbschema für eine Control Klasse fest.
+			 *
+			 * \param type
+			 * \param style
+			 */
+			void SetControlStyle(ControlType type, ControlStyle &&style);
+			/**
+			 * Ruft das Farbschema für eine Control Klasse ab.
+			 *
+			 * \param controlClass
+			 * \return style
+			 */
+			const ControlStyle& GetControlStyle(ControlType type) const;
+
+		private:
+			std::map<ControlType, ControlStyle> controlStyles;
+		};
+	}
+}
@@ -1,105 +1,106 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_DRAWING_TEXTURE_HPP
-#define OSHGUI_DRAWING_TEXTURE_HPP
-
-#include "../Exports.hpp"
-#include "Size.hpp"
-#include "Point.hpp"
-#include "Rectangle.hpp"
-#include "Vertex.hpp"
-#include "../Misc/Strings.hpp"
-#include <memory>
-
-namespace OSHGui
-{
-	namespace Drawing
-	{
-		/**
-		 * Die abstrakte Klasse reprsentiert eine Textur und wird durch den Renderer erstellt.
-		 */
-		class OSHGUI_EXPORT Texture
-		{
-		public:
-			/**
-			 * Auflistung der mglichen PixelFormate.
-			 */
-			enum class PixelFormat
-			{
-				RGB,
-				RGBA,
-				RGBA_4444,
-				RGB_565,
-				PVRTC2,
-				PVRTC4,
-				RGB_DXT1,
-				RGBA_DXT1,
-				RGBA_DXT3,
-				RGBA_DXT5
-			};
-
-			/**
-			 * Destructor der Klasse.
-			 */
-			virtual ~Texture()
-			{
-
-			}
-
-			/**
-			 * Ruft die (eventuell gepaddete) Gre der Textur in Pixeln ab.
-			 *
-			 * \return Gre der Textur
-			 */
-			virtual const SizeF& GetSize() const = 0;
-
-			/**
-			 * Ruft die Originalgre der Daten der Textur ab, mit denen sie erstellt wurde.
-			 *
-			 * \return Originalgre der Textur
-			 */
-			virtual const SizeF& GetOriginalDataSize() const = 0;
-
-			/**
-			 * Ruft die Pixel-zu-Texel Werte ab, die benutzt werden um Pixelwerte zu Texturkoordinaten umzurechnen.
-			 *
-			 * \return Pixel-zu-Texel Werte
-			 */
-			virtual const std::pair<float, float>& GetTexelScaling() const = 0;
-
-			/**
-			 * Ldt die Textur aus einer Datei.
-			 *
-			 * \param path Pfad zur Datei
-			 */
-			virtual void LoadFromFile(const Misc::AnsiString &path) = 0;
-
-			/**
-			 * Ldt die Textur aus dem Speicher. Die Daten im Buffer mssen im angegebenen Pixelformat vorliegen.
-			 *
-			 * \param buffer
-			 * \param size die Gre des Bildes
-			 * \param format
-			 */
-			virtual void LoadFromMemory(const void *buffer, const SizeF &size, PixelFormat format) = 0;
-
-			/**
-			 * Prft, ob Texturen im angegebenen Format erstellt werden knnen.
-			 *
-			 * \param format das PixelFormat
-			 * \return true falls das Format untersttzt wird
-			 */
-			virtual bool IsPixelFormatSupported(const PixelFormat format) const = 0;
-		};
-
-		typedef std::shared_ptr<Texture> TexturePtr;
-	}
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_DRAWING_TEXTURE_HPP
+#define OSHGUI_DRAWING_TEXTURE_HPP
+
+#include "../Exports.hpp"
+#include "Size.hpp"
+#include "Point.hpp"
+#include "Rectangle.hpp"
+#include "Vertex.hpp"
+#include "../Misc/Strings.hpp"
+#include <memory>
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		/**
+		 * Die abstrakte Klasse repräsentiert eine Textur und wird durch den Renderer erstellt.
+		 */
+		class OSHGUI_EXPORT Texture
+		{
+		public:
+			/**
+			 * Auflistung der möglichen PixelFormate.
+			 */
+			enum class PixelFormat
+			{
+				RGB,
+				RGBA,
+				RGBA_4444,
+				RGB_565,
+				PVRTC2,
+				PVRTC4,
+				RGB_DXT1,
+				RGBA_DXT1,
+				RGBA_DXT3,
+				RGBA_DXT5,
+				RGBA_DISTANCE_FIELD //RGBA, der Alphakanal enthält ein Distanzfeld (0.5 = Kante)
+			};
+
+			/**
+			 * Destructor der Klasse.
+			 */
+			virtual ~Texture()
+			{
+
+			}
+
+			/**
+			 * Ruft die (eventuell gepaddete) Größe der Textur in Pixeln ab.
+			 *
+			 * \return Größe der Textur
+			 */
+			virtual const SizeF& GetSize() const = 0;
+
+			/**
+			 * Ruft die Originalgröße der Daten der Textur ab, mit denen sie erstellt wurde.
+			 *
+			 * \return Originalgröße der Textur
+			 */
+			virtual const SizeF& GetOriginalDataSize() const = 0;
+
+			/**
+			 * Ruft die Pixel-zu-Texel Werte ab, die benutzt werden um Pixelwerte zu Texturkoordinaten umzurechnen.
+			 *
+			 * \return Pixel-zu-Texel Werte
+			 */
+			virtual const std::pair<float, float>& GetTexelScaling() const = 0;
+
+			/**
+			 * Lädt die Textur aus einer Datei.
+			 *
+			 * \param path Pfad zur Datei
+			 */
+			virtual void LoadFromFile(const Misc::AnsiString &path) = 0;
+
+			/**
+			 * Lädt die Textur aus dem Speicher. Die Daten im Buffer müssen im angegebenen Pixelformat vorliegen.
+			 *
+			 * \param buffer
+			 * \param size die Größe des Bildes
+			 * \param format
+			 */
+			virtual void LoadFromMemory(const void *buffer, const SizeF &size, PixelFormat format) = 0;
+
+			/**
+			 * Prüft, ob Texturen im angegebenen Format erstellt werden können.
+			 *
+			 * \param format das PixelFormat
+			 * \return true falls das Format unterstützt wird
+			 */
+			virtual bool IsPixelFormatSupported(const PixelFormat format) const = 0;
+		};
+
+		typedef std::shared_ptr<Texture> TexturePtr;
+	}
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,539 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Theme.hpp"
+#include "FontManager.hpp"
+#include "FontLocator.hpp"
+#include "../Misc/MemoryMappedFile.hpp"
+#include <json/json.h>
+#include <sys/stat.h>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		namespace
+		{
+			const uint32_t Magic = 0x4854534F; //OSTH
+			const uint32_t Version = 1;
+
+			struct ControlName
+			{
+				const char *Name;
+				ControlType Type;
+			};
+
+			const ControlName ControlNames[] = {
+				{ "button", ControlType::Button },
+				{ "checkbox", ControlType::CheckBox },
+				{ "colorbar", ControlType::ColorBar },
+				{ "colorpicker", ControlType::ColorPicker },
+				{ "combobox", ControlType::ComboBox },
+				{ "form", ControlType::Form },
+				{ "groupbox", ControlType::GroupBox },
+				{ "hotkeycontrol", ControlType::HotkeyControl },
+				{ "label", ControlType::Label },
+				{ "linklabel", ControlType::LinkLabel },
+				{ "listbox", ControlType::ListBox },
+				{ "listview", ControlType::ListView },
+				{ "multilinetextbox", ControlType::MultiLineTextBox },
+				{ "panel", ControlType::Panel },
+				{ "picturebox", ControlType::PictureBox },
+				{ "progressbar", ControlType::ProgressBar },
+				{ "radiobutton", ControlType::RadioButton },
+				{ "scrollbar", ControlType::ScrollBar },
+				{ "scrollpanel", ControlType::ScrollPanel },
+				{ "tabcontrol", ControlType::TabControl },
+				{ "tabpage", ControlType::TabPage },
+				{ "textbox", ControlType::TextBox },
+				{ "timer", ControlType::Timer },
+				{ "trackbar", ControlType::TrackBar }
+			};
+			//---------------------------------------------------------------------------
+			bool GetControlType(const Misc::AnsiString &name, ControlType &type)
+			{
+				auto lower = name;
+				std::transform(lower.begin(), lower.end(), lower.begin(), [](Misc::AnsiChar c) { return static_cast<Misc::AnsiChar>(std::tolower(static_cast<unsigned char>(c))); });
+				for (auto &entry : ControlNames)
+				{
+					if (lower == entry.Name)
+					{
+						type = entry.Type;
+						return true;
+					}
+				}
+				return false;
+			}
+			//---------------------------------------------------------------------------
+			const char* GetControlName(ControlType type)
+			{
+				for (auto &entry : ControlNames)
+				{
+					if (entry.Type == type)
+					{
+						return entry.Name;
+					}
+				}
+				return nullptr;
+			}
+			//---------------------------------------------------------------------------
+			Color ReadColor(const Json::Value &value, const Color &fallback)
+			{
+				if (value.isString())
+				{
+					//"AARRGGBB", optional mit vorangestelltem '#'
+					auto text = value.asString();
+					if (!text.empty() && text[0] == '#')
+					{
+						text.erase(0, 1);
+					}
+					char *end = nullptr;
+					const auto argb = std::strtoul(text.c_str(), &end, 16);
+					if (!text.empty() && *end == '\0')
+					{
+						return Color(static_cast<argb_t>(argb));
+					}
+				}
+				else if (value.isNumeric())
+				{
+					return Color(static_cast<argb_t>(value.asUInt()));
+				}
+				return fallback;
+			}
+			//---------------------------------------------------------------------------
+			Theme::ControlTheme ReadControlTheme(const Json::Value &value, const Theme::ControlTheme &fallback)
+			{
+				Theme::ControlTheme theme = fallback;
+				if (value.isObject())
+				{
+					theme.ForeColor = ReadColor(value["forecolor"], fallback.ForeColor);
+					theme.BackColor = ReadColor(value["backcolor"], fallback.BackColor);
+					if (value["font"].isString())
+					{
+						theme.FontName = value["font"].asString();
+					}
+					if (value["fontsize"].isNumeric())
+					{
+						theme.FontSize = static_cast<float>(value["fontsize"].asDouble());
+					}
+				}
+				return theme;
+			}
+			//---------------------------------------------------------------------------
+			Json::Value WriteControlTheme(const Theme::ControlTheme &theme)
+			{
+				char buffer[9];
+
+				Json::Value value(Json::objectValue);
+				std::sprintf(buffer, "%08X", theme.ForeColor.GetARGB());
+				value["forecolor"] = buffer;
+				std::sprintf(buffer, "%08X", theme.BackColor.GetARGB());
+				value["backcolor"] = buffer;
+				if (!theme.FontName.empty())
+				{
+					value["font"] = theme.FontName;
+					value["fontsize"] = theme.FontSize;
+				}
+				return value;
+			}
+			//---------------------------------------------------------------------------
+			template<typename T>
+			bool Read(const uint8_t *data, size_t size, size_t &position, T &value)
+			{
+				if (sizeof(T) > size - position)
+				{
+					return false;
+				}
+				std::memcpy(&value, data + position, sizeof(T));
+				position += sizeof(T);
+				return true;
+			}
+			//---------------------------------------------------------------------------
+			bool ReadString(const uint8_t *data, size_t size, size_t &position, Misc::AnsiString &value)
+			{
+				uint32_t length;
+				if (!Read(data, size, position, length) || length > size - position)
+				{
+					return false;
+				}
+				value.assign(reinterpret_cast<const char*>(data + position), length);
+				position += length;
+				return true;
+			}
+			//---------------------------------------------------------------------------
+			bool ReadControlTheme(const uint8_t *data, size_t size, size_t &position, Theme::ControlTheme &theme)
+			{
+				argb_t foreColor, backColor;
+				if (!Read(data, size, position, foreColor) || !Read(data, size, position, backColor) || !Read(data, size, position, theme.FontSize) || !ReadString(data, size, position, theme.FontName))
+				{
+					return false;
+				}
+				theme.ForeColor = Color(foreColor);
+				theme.BackColor = Color(backColor);
+				return true;
+			}
+			//---------------------------------------------------------------------------
+			template<typename T>
+			void Write(std::ofstream &out, const T &value)
+			{
+				out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+			}
+			//---------------------------------------------------------------------------
+			void WriteString(std::ofstream &out, const Misc::AnsiString &value)
+			{
+				Write(out, static_cast<uint32_t>(value.length()));
+				out.write(value.data(), value.length());
+			}
+			//---------------------------------------------------------------------------
+			void WriteControlTheme(std::ofstream &out, const Theme::ControlTheme &theme)
+			{
+				Write(out, theme.ForeColor.GetARGB());
+				Write(out, theme.BackColor.GetARGB());
+				Write(out, theme.FontSize);
+				WriteString(out, theme.FontName);
+			}
+		}
+		//---------------------------------------------------------------------------
+		//Theme::ControlTheme
+		//---------------------------------------------------------------------------
+		Theme::ControlTheme::ControlTheme()
+			: FontSize(0.0f)
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		Theme::ControlTheme::ControlTheme(const Color &foreColor, const Color &backColor)
+			: ForeColor(foreColor),
+			  BackColor(backColor),
+			  FontSize(0.0f)
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		//Theme
+		//---------------------------------------------------------------------------
+		void Theme::SetControlTheme(ControlType type, const ControlTheme &theme)
+		{
+			controlThemes_[type] = theme;
+		}
+		//---------------------------------------------------------------------------
+		const Theme::ControlTheme& Theme::GetControlTheme(ControlType type) const
+		{
+			const auto it = controlThemes_.find(type);
+			if (it == controlThemes_.end())
+			{
+				return DefaultTheme;
+			}
+
+			return it->second;
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		bool Theme::Load(const Misc::AnsiString &file)
+		{
+			Misc::MemoryMappedFile mapping;
+			if (!mapping.Open(file))
+			{
+				return false;
+			}
+
+			uint32_t magic = 0;
+			if (mapping.GetSize() >= sizeof(magic))
+			{
+				std::memcpy(&magic, mapping.GetDataPointer(), sizeof(magic));
+			}
+
+			if (magic == Magic)
+			{
+				return ParseBinary(mapping.GetDataPointer(), mapping.GetSize());
+			}
+			return ParseJson(reinterpret_cast<const char*>(mapping.GetDataPointer()), mapping.GetSize());
+		}
+		//---------------------------------------------------------------------------
+		bool Theme::ParseJson(const char *data, size_t size)
+		{
+			Json::Value root;
+			Json::Reader reader;
+			if (!reader.parse(data, data + size, root, false) || !root.isObject())
+			{
+				return false;
+			}
+
+			Theme theme;
+			theme.Name = root.get("name", "").asString();
+			theme.Author = root.get("author", "").asString();
+			theme.DefaultTheme = ReadControlTheme(root["default"], ControlTheme(Color::White(), Color::Empty()));
+
+			const auto &controls = root["controls"];
+			if (controls.isObject())
+			{
+				for (auto &name : controls.getMemberNames())
+				{
+					ControlType type;
+					if (GetControlType(name, type))
+					{
+						theme.controlThemes_[type] = ReadControlTheme(controls[name], theme.DefaultTheme);
+					}
+				}
+			}
+
+			if (!theme.HasValidFonts())
+			{
+				return false;
+			}
+
+			*this = std::move(theme);
+
+			return true;
+		}
+		//---------------------------------------------------------------------------
+		bool Theme::ParseBinary(const uint8_t *data, size_t size)
+		{
+			size_t position = 0;
+			uint32_t magic, version, count;
+			Theme theme;
+			if (!Read(data, size, position, magic) || magic != Magic || !Read(data, size, position, version) || version != Version
+				|| !ReadString(data, size, position, theme.Name) || !ReadString(data, size, position, theme.Author)
+				|| !ReadControlTheme(data, size, position, theme.DefaultTheme) || !Read(data, size, position, count))
+			{
+				return false;
+			}
+
+			for (auto i = 0u; i < count; ++i)
+			{
+				Misc::AnsiString name;
+				ControlTheme controlTheme;
+				if (!ReadString(data, size, position, name) || !ReadControlTheme(data, size, position, controlTheme))
+				{
+					return false;
+				}
+
+				ControlType type;
+				if (GetControlType(name, type))
+				{
+					theme.controlThemes_[type] = std::move(controlTheme);
+				}
+			}
+
+			if (!theme.HasValidFonts())
+			{
+				return false;
+			}
+
+			*this = std::move(theme);
+
+			return true;
+		}
+		//---------------------------------------------------------------------------
+		bool Theme::HasValidFonts() const
+		{
+			//ToStyle würde bei einer unbekannten Schriftart eine Exception werfen
+			auto isValid = [](const ControlTheme &theme)
+			{
+				return theme.FontName.empty() || theme.FontSize <= 0.0f || FontLocator::FindFont(theme.FontName) != nullptr;
+			};
+
+			if (!isValid(DefaultTheme))
+			{
+				return false;
+			}
+			for (auto &it : controlThemes_)
+			{
+				if (!isValid(it.second))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		//---------------------------------------------------------------------------
+		bool Theme::Save(const Misc::AnsiString &file, Format format) const
+		{
+			return format == Format::Json ? SaveJson(file) : SaveBinary(file);
+		}
+		//---------------------------------------------------------------------------
+		bool Theme::SaveJson(const Misc::AnsiString &file) const
+		{
+			Json::Value root(Json::objectValue);
+			root["name"] = Name;
+			root["author"] = Author;
+			root["default"] = WriteControlTheme(DefaultTheme);
+
+			auto &controls = root["controls"];
+			controls = Json::Value(Json::objectValue);
+			for (auto &it : controlThemes_)
+			{
+				const auto name = GetControlName(it.first);
+				if (name != nullptr)
+				{
+					controls[name] = WriteControlTheme(it.second);
+				}
+			}
+
+			std::ofstream out(file, std::ios::trunc);
+			if (!out)
+			{
+				return false;
+			}
+
+			Json::StyledWriter writer;
+			out << writer.write(root);
+
+			return static_cast<bool>(out);
+		}
+		//---------------------------------------------------------------------------
+		bool Theme::SaveBinary(const Misc::AnsiString &file) const
+		{
+			const auto temporaryPath = file + ".tmp";
+
+			{
+				std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+				if (!out)
+				{
+					return false;
+				}
+
+				Write(out, Magic);
+				Write(out, Version);
+				WriteString(out, Name);
+				WriteString(out, Author);
+				WriteControlTheme(out, DefaultTheme);
+
+				uint32_t count = 0;
+				for (auto &it : controlThemes_)
+				{
+					if (GetControlName(it.first) != nullptr)
+					{
+						++count;
+					}
+				}
+				Write(out, count);
+				for (auto &it : controlThemes_)
+				{
+					const auto name = GetControlName(it.first);
+					if (name != nullptr)
+					{
+						WriteString(out, name);
+						WriteControlTheme(out, it.second);
+					}
+				}
+
+				if (!out)
+				{
+					out.close();
+					std::remove(temporaryPath.c_str());
+					return false;
+				}
+			}
+
+			//ein beobachtender Leser sieht nie eine halb geschriebene Datei
+			std::remove(file.c_str());
+			return std::rename(temporaryPath.c_str(), file.c_str()) == 0;
+		}
+		//---------------------------------------------------------------------------
+		Style Theme::ToStyle() const
+		{
+			auto convert = [](const ControlTheme &theme)
+			{
+				Style::ControlStyle style;
+				style.ForeColor = theme.ForeColor;
+				style.BackColor = theme.BackColor;
+				if (!theme.FontName.empty() && theme.FontSize > 0.0f)
+				{
+					//der FontManager liefert für gleiche Angaben dieselbe Schrift, ApplyStyleChanges erkennt unveränderte Schriften daher am Zeiger
+					style.Font = FontManager::LoadFreeTypeFont(theme.FontName, theme.FontSize, true);
+				}
+				return style;
+			};
+
+			Style style;
+			style.DefaultColor = convert(DefaultTheme);
+			for (auto &it : controlThemes_)
+			{
+				style.SetControlStyle(it.first, convert(it.second));
+			}
+			return style;
+		}
+		//---------------------------------------------------------------------------
+		//ThemeWatcher
+		//---------------------------------------------------------------------------
+		ThemeWatcher::ThemeWatcher()
+			: lastWriteTime_(0),
+			  lastSize_(-1)
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		void ThemeWatcher::SetFile(const Misc::AnsiString &file)
+		{
+			file_ = file;
+			lastWriteTime_ = 0;
+			lastSize_ = -1;
+
+			if (!file_.empty())
+			{
+				GetFileState(lastWriteTime_, lastSize_);
+			}
+		}
+		//---------------------------------------------------------------------------
+		const Misc::AnsiString& ThemeWatcher::GetFile() const
+		{
+			return file_;
+		}
+		//---------------------------------------------------------------------------
+		bool ThemeWatcher::HasChanged()
+		{
+			if (file_.empty())
+			{
+				return false;
+			}
+
+			std::time_t writeTime;
+			long long size;
+			if (!GetFileState(writeTime, size) || (writeTime == lastWriteTime_ && size == lastSize_))
+			{
+				return false;
+			}
+
+			lastWriteTime_ = writeTime;
+			lastSize_ = size;
+
+			return true;
+		}
+		//---------------------------------------------------------------------------
+		bool ThemeWatcher::GetFileState(std::time_t &time, long long &size) const
+		{
+			#ifdef _WIN32
+			struct _stat64 info;
+			if (_stat64(file_.c_str(), &info) != 0)
+			{
+				return false;
+			}
+			#else
+			struct stat info;
+			if (stat(file_.c_str(), &info) != 0)
+			{
+				return false;
+			}
+			#endif
+
+			time = info.st_mtime;
+			size = static_cast<long long>(info.st_size);
+
+			return true;
+		}
+		//---------------------------------------------------------------------------
+	}
+}
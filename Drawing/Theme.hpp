@@ -0,0 +1,153 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_DRAWING_THEME_HPP
+#define OSHGUI_DRAWING_THEME_HPP
+
+#include <map>
+#include <ctime>
+#include <cstdint>
+#include "../Exports.hpp"
+#include "../Misc/Strings.hpp"
+#include "../Controls/Types.hpp"
+#include "Color.hpp"
+#include "Style.hpp"
+
+namespace OSHGui
+{
+	namespace Drawing
+	{
+		/**
+		 * Beschreibt Farben und Schriftarten der Control Klassen. Ein Theme wird aus einer
+		 * JSON-Datei gelesen und kann für den Einsatz in fertigen Programmen in eine
+		 * kompakte Binärdatei übersetzt werden, die beim Laden nur eingeblendet wird.
+		 *
+		 * \code
+		 * {
+		 *   "name": "Dark",
+		 *   "author": "...",
+		 *   "default": { "forecolor": "FFFFFFFF", "backcolor": "FF222222", "font": "Arial", "fontsize": 8 },
+		 *   "controls": { "button": { "backcolor": "FF4E4E4E" } }
+		 * }
+		 * \endcode
+		 */
+		class OSHGUI_EXPORT Theme
+		{
+		public:
+			enum class Format
+			{
+				Json,
+				Binary
+			};
+
+			struct ControlTheme
+			{
+				Color ForeColor;
+				Color BackColor;
+				/**
+				 * Name der Schriftart. Leer behält die Schriftart des Controls bei.
+				 */
+				Misc::AnsiString FontName;
+				float FontSize;
+
+				ControlTheme();
+				ControlTheme(const Color &foreColor, const Color &backColor);
+			};
+
+			Misc::AnsiString Name;
+			Misc::AnsiString Author;
+			ControlTheme DefaultTheme;
+
+			/**
+			 * Legt das Theme für eine Control Klasse fest.
+			 *
+			 * \param type
+			 * \param theme
+			 */
+			void SetControlTheme(ControlType type, const ControlTheme &theme);
+			/**
+			 * Ruft das Theme für eine Control Klasse ab.
+			 *
+			 * \param type
+			 * \return theme
+			 */
+			const ControlTheme& GetControlTheme(ControlType type) const;
+
+			/**
+			 * Lädt das Theme aus einer JSON- oder Binärdatei. Das Format wird am Inhalt erkannt.
+			 * Schlägt das Laden fehl, bleibt das Theme unverändert.
+			 *
+			 * \param file
+			 * \return false, falls die Datei nicht gelesen werden konnte oder eine Schriftart nicht installiert ist
+			 */
+			bool Load(const Misc::AnsiString &file);
+			/**
+			 * Speichert das Theme im angegebenen Format.
+			 *
+			 * \param file
+			 * \param format
+			 * \return false, falls die Datei nicht geschrieben werden konnte
+			 */
+			bool Save(const Misc::AnsiString &file, Format format) const;
+
+			/**
+			 * Erzeugt einen Style aus dem Theme und lädt die benötigten Schriftarten.
+			 *
+			 * \return style
+			 */
+			Style ToStyle() const;
+
+		private:
+			bool ParseJson(const char *data, size_t size);
+			bool ParseBinary(const uint8_t *data, size_t size);
+			bool HasValidFonts() const;
+			bool SaveJson(const Misc::AnsiString &file) const;
+			bool SaveBinary(const Misc::AnsiString &file) const;
+
+			std::map<ControlType, ControlTheme> controlThemes_;
+		};
+
+		/**
+		 * Erkennt Änderungen an einer Theme-Datei anhand von Änderungszeit und Größe.
+		 */
+		class OSHGUI_EXPORT ThemeWatcher
+		{
+		public:
+			ThemeWatcher();
+
+			/**
+			 * Legt die beobachtete Datei fest. Ein leerer Pfad beendet die Beobachtung.
+			 *
+			 * \param file
+			 */
+			void SetFile(const Misc::AnsiString &file);
+			/**
+			 * Ruft die beobachtete Datei ab.
+			 *
+			 * \return file
+			 */
+			const Misc::AnsiString& GetFile() const;
+
+			/**
+			 * Prüft, ob die Datei seit dem letzten Aufruf geändert wurde.
+			 *
+			 * \return ja / nein
+			 */
+			bool HasChanged();
+
+		private:
+			bool GetFileState(std::time_t &time, long long &size) const;
+
+			Misc::AnsiString file_;
+			std::time_t lastWriteTime_;
+			long long lastSize_;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,231 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_EVENT_DELEGATE_HPP
+#define OSHGUI_EVENT_DELEGATE_HPP
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+namespace OSHGui
+{
+	template<typename Signature>
+	class Delegate;
+
+	/**
+	 * Speichert eine aufrufbare Funktion ähnlich std::function. Funktionsobjekte bis zur
+	 * Größe von BufferSize (z.B. Lambdas mit wenigen Captures) werden ohne Heap-Allokation
+	 * direkt im Delegate abgelegt, nur größere Objekte werden auf dem Heap angelegt.
+	 */
+	template<typename R, typename ...Args>
+	class Delegate<R(Args...)>
+	{
+	public:
+		static const std::size_t BufferSize = 4 * sizeof(void*);
+
+		/**
+		 * Konstruktor der Klasse. Legt einen leeren Delegate an.
+		 */
+		Delegate()
+			: invoke_(nullptr),
+			  manage_(nullptr)
+		{
+
+		}
+		/**
+		 * Konstruktor der Klasse.
+		 *
+		 * \param function die gebundene Funktion
+		 */
+		template<typename F, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, Delegate>::value>::type>
+		Delegate(F &&function)
+			: invoke_(nullptr),
+			  manage_(nullptr)
+		{
+			typedef typename std::decay<F>::type Function;
+			typedef typename std::conditional<IsInline<Function>::value, InlineStorage<Function>, HeapStorage<Function>>::type Storage;
+
+			Storage::Create(&storage_, std::forward<F>(function));
+			invoke_ = &Storage::Invoke;
+			manage_ = &Storage::Manage;
+		}
+		Delegate(const Delegate &other)
+			: invoke_(nullptr),
+			  manage_(nullptr)
+		{
+			CopyFrom(other);
+		}
+		//noexcept, damit std::vector beim Wachsen verschiebt statt zu kopieren
+		Delegate(Delegate &&other) noexcept
+			: invoke_(nullptr),
+			  manage_(nullptr)
+		{
+			MoveFrom(other);
+		}
+		~Delegate()
+		{
+			Reset();
+		}
+
+		Delegate& operator=(const Delegate &other)
+		{
+			if (this != &other)
+			{
+				Reset();
+				CopyFrom(other);
+			}
+			return *this;
+		}
+		Delegate& operator=(Delegate &&other) noexcept
+		{
+			if (this != &other)
+			{
+				Reset();
+				MoveFrom(other);
+			}
+			return *this;
+		}
+
+		/**
+		 * Ruft ab, ob eine Funktion gebunden ist.
+		 */
+		explicit operator bool() const
+		{
+			return invoke_ != nullptr;
+		}
+
+		/**
+		 * Ruft die gebundene Funktion auf.
+		 */
+		R operator()(Args ...args) const
+		{
+			return invoke_(&storage_, std::forward<Args>(args)...);
+		}
+
+	private:
+		enum class Operation
+		{
+			Copy,
+			Move,
+			Destroy
+		};
+
+		typedef typename std::aligned_storage<BufferSize, alignof(std::max_align_t)>::type Buffer;
+		typedef R (*InvokeFunction)(void *storage, Args&& ...args);
+		typedef void (*ManageFunction)(Operation operation, void *source, void *target);
+
+		template<typename F>
+		struct IsInline
+		{
+			static const bool value = sizeof(F) <= BufferSize
+				&& alignof(std::max_align_t) % alignof(F) == 0
+				&& std::is_nothrow_move_constructible<F>::value;
+		};
+
+		template<typename F>
+		struct InlineStorage
+		{
+			template<typename T>
+			static void Create(void *storage, T &&function)
+			{
+				new (storage) F(std::forward<T>(function));
+			}
+			static R Invoke(void *storage, Args&& ...args)
+			{
+				return (*static_cast<F*>(storage))(std::forward<Args>(args)...);
+			}
+			static void Manage(Operation operation, void *source, void *target)
+			{
+				auto function = static_cast<F*>(source);
+				switch (operation)
+				{
+					case Operation::Copy:
+						new (target) F(*function);
+						break;
+					case Operation::Move:
+						new (target) F(std::move(*function));
+						function->~F();
+						break;
+					case Operation::Destroy:
+						function->~F();
+						break;
+				}
+			}
+		};
+
+		template<typename F>
+		struct HeapStorage
+		{
+			template<typename T>
+			static void Create(void *storage, T &&function)
+			{
+				*static_cast<F**>(storage) = new F(std::forward<T>(function));
+			}
+			static R Invoke(void *storage, Args&& ...args)
+			{
+				return (**static_cast<F**>(storage))(std::forward<Args>(args)...);
+			}
+			static void Manage(Operation operation, void *source, void *target)
+			{
+				auto function = *static_cast<F**>(source);
+				switch (operation)
+				{
+					case Operation::Copy:
+						*static_cast<F**>(target) = new F(*function);
+						break;
+					case Operation::Move:
+						*static_cast<F**>(target) = function;
+						break;
+					case Operation::Destroy:
+						delete function;
+						break;
+				}
+			}
+		};
+
+		void CopyFrom(const Delegate &other)
+		{
+			if (other.manage_ != nullptr)
+			{
+				other.manage_(Operation::Copy, &other.storage_, &storage_);
+				invoke_ = other.invoke_;
+				manage_ = other.manage_;
+			}
+		}
+		void MoveFrom(Delegate &other)
+		{
+			if (other.manage_ != nullptr)
+			{
+				other.manage_(Operation::Move, &other.storage_, &storage_);
+				invoke_ = other.invoke_;
+				manage_ = other.manage_;
+
+				other.invoke_ = nullptr;
+				other.manage_ = nullptr;
+			}
+		}
+		void Reset()
+		{
+			if (manage_ != nullptr)
+			{
+				manage_(Operation::Destroy, &storage_, nullptr);
+				invoke_ = nullptr;
+				manage_ = nullptr;
+			}
+		}
+
+		//der Aufruf ist wie bei std::function const, das gespeicherte Funktionsobjekt muss es nicht sein
+		mutable Buffer storage_;
+		InvokeFunction invoke_;
+		ManageFunction manage_;
+	};
+}
+
+#endif
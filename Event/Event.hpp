@@ -1,148 +1,175 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_EVENT_EVENT_HPP
-#define OSHGUI_EVENT_EVENT_HPP
-
-#include <functional>
-#include <algorithm>
-
-#include "EventHandler.hpp"
-#include "../Exports.hpp"
-
-namespace OSHGui
-{
-	/**
-	 * Event fr Funktionen mit einem Parameter.
-	 */
-	template<typename Signature>
-	class OSHGUI_EXPORT Event
-	{
-	private:
-		class EventHandlerInfo
-		{
-		public:
-			EventHandler<Signature> EventHandler;
-			bool Remove;
-		};
-
-		std::vector<EventHandlerInfo> eventHandlerInfos_;
-
-	public:
-		/**
-		 * Registriert einen EventHandler.
-		 *
-		 * \param eventHandler
-		 */
-		Event& operator+=(const EventHandler<Signature> &eventHandler)
-		{
-			EventHandlerInfo info = {
-				eventHandler,
-				false
-			};
-			eventHandlerInfos_.push_back(info);
-
-			return *this;
-		}
-		
-		/**
-		 * Entfernt einen EventHandler.
-		 *
-		 * \param eventHandler
-		 */
-		Event& operator-=(const EventHandler<Signature> &eventHandler)
-		{
-			for (auto &info : eventHandlerInfos_)
-			{
-				if (info.EventHandler == eventHandler)
-				{
-					info.Remove = true;
-				}
-			}
-
-			return *this;
-		}
-
-#if (_MSC_VER >= 1800) //VS2013
-
-		/**
-		* Ruft alle registrierten EventHandler auf.
-		*/
-		template <typename ...Params>
-		void Invoke(Params&& ...params)
-		{
-			eventHandlerInfos_.erase(std::remove_if(std::begin(eventHandlerInfos_), std::end(eventHandlerInfos_), [&](const EventHandlerInfo &info)
-			{
-				if (!info.Remove)
-				{
-					info.EventHandler.GetHandler()(std::forward<Params>(params)...);
-				}
-				return info.Remove;
-			}), std::end(eventHandlerInfos_));
-		}
-
-#else //no variadic template support
-
-		/**
-		* Ruft alle registrierten EventHandler auf.
-		*/
-		void Invoke()
-		{
-			eventHandlerInfos_.erase(std::remove_if(std::begin(eventHandlerInfos_), std::end(eventHandlerInfos_), [&](const EventHandlerInfo &info)
-			{
-				if (!info.Remove)
-				{
-					info.EventHandler.GetHandler()();
-				}
-				return info.Remove;
-			}), std::end(eventHandlerInfos_));
-		}
-		
-		/**
-		 * Ruft alle registrierten EventHandler auf.
-		 *
-		 * \param param1 Funktionsparameter
-		 */
-		template <typename T>
-		void Invoke(T&& param1)
-		{
-			eventHandlerInfos_.erase(std::remove_if(std::begin(eventHandlerInfos_), std::end(eventHandlerInfos_), [&](const EventHandlerInfo &info)
-			{
-				if (!info.Remove)
-				{
-					info.EventHandler.GetHandler()(std::forward<T>(param1));
-				}
-				return info.Remove;
-			}), std::end(eventHandlerInfos_));
-		}
-
-		/**
-		 * Ruft alle registrierten EventHandler auf.
-		 *
-		 * \param param1 Funktionsparameter
-		 * \param param2 Funktionsparameter
-		 */
-		template <typename T, typename T2>
-		void Invoke(T&& param1, T2&& param2)
-		{
-			eventHandlerInfos_.erase(std::remove_if(std::begin(eventHandlerInfos_), std::end(eventHandlerInfos_), [&](const EventHandlerInfo &info)
-			{
-				if (!info.Remove)
-				{
-					info.EventHandler.GetHandler()(std::forward<T>(param1), std::forward<T2>(param2));
-				}
-				return info.Remove;
-			}), std::end(eventHandlerInfos_));
-		}
-
-#endif
-
-	};
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_EVENT_EVENT_HPP
+#define OSHGUI_EVENT_EVENT_HPP
+
+#include <vector>
+#include <algorithm>
+
+#include "EventHandler.hpp"
+#include "../Exports.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Event für Funktionen mit einem Parameter.
+	 */
+	template<typename Signature>
+	class OSHGUI_EXPORT Event
+	{
+	private:
+		class EventHandlerInfo
+		{
+		public:
+			EventHandler<Signature> EventHandler;
+			bool Remove;
+		};
+
+		/**
+		 * Zählt die laufenden Invoke-Aufrufe und räumt nach dem äußersten auf.
+		 */
+		class InvokeScope
+		{
+		public:
+			InvokeScope(Event &event)
+				: event_(event)
+			{
+				++event_.invokeDepth_;
+			}
+			~InvokeScope()
+			{
+				if (--event_.invokeDepth_ == 0 && event_.isDirty_)
+				{
+					event_.Compact();
+				}
+			}
+
+		private:
+			InvokeScope(const InvokeScope&);
+			void operator=(const InvokeScope&);
+
+			Event &event_;
+		};
+
+		std::vector<EventHandlerInfo> eventHandlerInfos_;
+		//während Invoke registrierte EventHandler werden erst danach übernommen
+		std::vector<EventHandlerInfo> addedEventHandlerInfos_;
+		int invokeDepth_;
+		bool isDirty_;
+
+		void Compact()
+		{
+			eventHandlerInfos_.erase(std::remove_if(std::begin(eventHandlerInfos_), std::end(eventHandlerInfos_), [](const EventHandlerInfo &info)
+			{
+				return info.Remove;
+			}), std::end(eventHandlerInfos_));
+
+			for (auto &info : addedEventHandlerInfos_)
+			{
+				if (!info.Remove)
+				{
+					eventHandlerInfos_.push_back(std::move(info));
+				}
+			}
+			addedEventHandlerInfos_.clear();
+
+			isDirty_ = false;
+		}
+
+	public:
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		Event()
+			: invokeDepth_(0),
+			  isDirty_(false)
+		{
+
+		}
+
+		/**
+		 * Registriert einen EventHandler.
+		 *
+		 * \param eventHandler
+		 */
+		Event& operator+=(const EventHandler<Signature> &eventHandler)
+		{
+			EventHandlerInfo info = {
+				eventHandler,
+				false
+			};
+			if (invokeDepth_ > 0)
+			{
+				addedEventHandlerInfos_.push_back(std::move(info));
+				isDirty_ = true;
+			}
+			else
+			{
+				eventHandlerInfos_.push_back(std::move(info));
+			}
+
+			return *this;
+		}
+		
+		/**
+		 * Entfernt einen EventHandler. Während eines Invoke wird der Eintrag nur markiert
+		 * und nach dem Invoke entfernt.
+		 *
+		 * \param eventHandler
+		 */
+		Event& operator-=(const EventHandler<Signature> &eventHandler)
+		{
+			for (auto &info : eventHandlerInfos_)
+			{
+				if (info.EventHandler == eventHandler)
+				{
+					info.Remove = true;
+					isDirty_ = true;
+				}
+			}
+			for (auto &info : addedEventHandlerInfos_)
+			{
+				if (info.EventHandler == eventHandler)
+				{
+					info.Remove = true;
+				}
+			}
+
+			if (invokeDepth_ == 0 && isDirty_)
+			{
+				Compact();
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Ruft alle registrierten EventHandler auf. Solange kein EventHandler entfernt
+		 * wurde, wird die Liste dabei nicht verändert.
+		 *
+		 * \param params Funktionsparameter
+		 */
+		template <typename ...Params>
+		void Invoke(Params&& ...params)
+		{
+			InvokeScope scope(*this);
+
+			for (std::size_t i = 0; i < eventHandlerInfos_.size(); ++i)
+			{
+				const auto &info = eventHandlerInfos_[i];
+				if (!info.Remove && info.EventHandler.GetHandler())
+				{
+					info.EventHandler.GetHandler()(params...);
+				}
+			}
+		}
+	};
+}
+
 #endif
\ No newline at end of file
@@ -1,74 +1,76 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_EVENT_EVENTHANDLER_HPP
-#define OSHGUI_EVENT_EVENTHANDLER_HPP
-
-#include <functional>
-#include "../Exports.hpp"
-
-namespace OSHGui
-{
-	/**
-	 * Stellt die Methode dar, die ein Ereignis behandelt.
-	 */
-	template <typename Signature>
-	class OSHGUI_EXPORT EventHandler
-	{
-	private:
-		typedef std::function<Signature> Handler;
-		Handler handler_;
-		int id_;
-		
-		static unsigned int NextID()
-		{
-			static unsigned int id = 0;
-			++id;
-			return id;
-		}
-		
-	public:
-		/**
-		 * Konstruktor der Klasse.
-		 */
-		EventHandler()
-			: id_(0)
-		{
-
-		}
-
-		/**
-		 * Konstruktor der Klasse.
-		 *
-		 * \param handler die gebundene Funktion
-		 */
-		EventHandler(const Handler &handler)
-			: handler_(handler),
-			  id_(NextID())
-		{
-			
-		}
-
-		bool operator==(const EventHandler &eventHandler)
-		{
-			return id_ == eventHandler.id_;
-		}
-		
-		/**
-		 * Ruft die gebundene Funktion ab.
-		 *
-		 * \return handler
-		 */
-		const Handler& GetHandler() const
-		{
-			return handler_;
-		}
-	};
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_EVENT_EVENTHANDLER_HPP
+#define OSHGUI_EVENT_EVENTHANDLER_HPP
+
+#include <atomic>
+#include <type_traits>
+#include "Delegate.hpp"
+#include "../Exports.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Stellt die Methode dar, die ein Ereignis behandelt.
+	 */
+	template <typename Signature>
+	class OSHGUI_EXPORT EventHandler
+	{
+	private:
+		typedef Delegate<Signature> Handler;
+		Handler handler_;
+		unsigned int id_;
+		
+		static unsigned int NextID()
+		{
+			static std::atomic<unsigned int> id(0);
+			return ++id;
+		}
+		
+	public:
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		EventHandler()
+			: id_(0)
+		{
+
+		}
+
+		/**
+		 * Konstruktor der Klasse.
+		 *
+		 * \param handler die gebundene Funktion
+		 */
+		template<typename F, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, EventHandler>::value>::type>
+		EventHandler(F &&handler)
+			: handler_(std::forward<F>(handler)),
+			  id_(NextID())
+		{
+			
+		}
+
+		bool operator==(const EventHandler &eventHandler) const
+		{
+			return id_ == eventHandler.id_;
+		}
+		
+		/**
+		 * Ruft die gebundene Funktion ab.
+		 *
+		 * \return handler
+		 */
+		const Handler& GetHandler() const
+		{
+			return handler_;
+		}
+	};
+}
+
 #endif
\ No newline at end of file
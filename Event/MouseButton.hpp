@@ -1,28 +1,28 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_EVENT_MOUSEBUTTON_HPP
-#define OSHGUI_EVENT_MOUSEBUTTON_HPP
-
-namespace OSHGui
-{
-	/**
-	 * Gibt Konstanten an, die definieren, welche Maustaste gedrckt wurde.
-	 */
-	enum class MouseButton
-	{
-		None = 0,
-		Left,
-		Right,
-		Middle,
-		XButton1,
-		XButton2
-	};
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_EVENT_MOUSEBUTTON_HPP
+#define OSHGUI_EVENT_MOUSEBUTTON_HPP
+
+namespace OSHGui
+{
+	/**
+	 * Gibt Konstanten an, die definieren, welche Maustaste gedrückt wurde.
+	 */
+	enum class MouseButton
+	{
+		None = 0,
+		Left,
+		Right,
+		Middle,
+		XButton1,
+		XButton2
+	};
+}
+
 #endif
\ No newline at end of file
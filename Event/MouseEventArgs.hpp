@@ -1,39 +1,39 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_EVENT_MOUSEEVENTARGS_HPP
-#define OSHGUI_EVENT_MOUSEEVENTARGS_HPP
-
-#include "../Drawing/Point.hpp"
-#include "MouseMessage.hpp"
-
-namespace OSHGui
-{
-	/**
-	 * Stellt Daten fr MouseEvents bereit.
-	 */
-	class OSHGUI_EXPORT MouseEventArgs
-	{
-	public:
-		MouseState State;
-		Drawing::PointI Location;
-		
-	public:
-		/**
-		 * Konstruktor der Klasse
-		 */
-		MouseEventArgs(const MouseMessage &mouseEvent)
-			: State(mouseEvent.GetState()),
-			  Location(mouseEvent.GetLocation())
-		{
-			
-		}
-	};
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_EVENT_MOUSEEVENTARGS_HPP
+#define OSHGUI_EVENT_MOUSEEVENTARGS_HPP
+
+#include "../Drawing/Point.hpp"
+#include "MouseMessage.hpp"
+
+namespace OSHGui
+{
+	/**
+	 * Stellt Daten für MouseEvents bereit.
+	 */
+	class OSHGUI_EXPORT MouseEventArgs
+	{
+	public:
+		MouseState State;
+		Drawing::PointI Location;
+		
+	public:
+		/**
+		 * Konstruktor der Klasse
+		 */
+		MouseEventArgs(const MouseMessage &mouseEvent)
+			: State(mouseEvent.GetState()),
+			  Location(mouseEvent.GetLocation())
+		{
+			
+		}
+	};
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,84 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "InputRecorder.hpp"
+#include "../Application.hpp"
+
+namespace OSHGui
+{
+	namespace Input
+	{
+		//---------------------------------------------------------------------------
+		//Constructor
+		//---------------------------------------------------------------------------
+		InputRecorder::InputRecorder()
+			: isRecording_(false)
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		//Getter/Setter
+		//---------------------------------------------------------------------------
+		bool InputRecorder::IsRecording() const
+		{
+			return isRecording_;
+		}
+		//---------------------------------------------------------------------------
+		const InputRecording& InputRecorder::GetRecording() const
+		{
+			return recording_;
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		void InputRecorder::Start()
+		{
+			recording_.Clear();
+			start_ = Application::Instance().GetClock().GetNow();
+			isRecording_ = true;
+		}
+		//---------------------------------------------------------------------------
+		void InputRecorder::Stop()
+		{
+			isRecording_ = false;
+		}
+		//---------------------------------------------------------------------------
+		void InputRecorder::RecordMouseMessage(const MouseMessage &mouse)
+		{
+			if (isRecording_)
+			{
+				recording_.AddMouseMessage(GetOffset(mouse.GetTimestamp()), mouse);
+			}
+		}
+		//---------------------------------------------------------------------------
+		void InputRecorder::RecordKeyboardMessage(const KeyboardMessage &keyboard)
+		{
+			if (isRecording_)
+			{
+				recording_.AddKeyboardMessage(GetOffset(keyboard.GetTimestamp()), keyboard);
+			}
+		}
+		//---------------------------------------------------------------------------
+		void InputRecorder::RecordFrame()
+		{
+			if (isRecording_)
+			{
+				recording_.AddFrame(GetOffset(Misc::Clock::TimePoint()));
+			}
+		}
+		//---------------------------------------------------------------------------
+		Misc::Clock::Duration InputRecorder::GetOffset(const Misc::Clock::TimePoint &timestamp) const
+		{
+			const auto time = timestamp == Misc::Clock::TimePoint() ? Application::Instance().GetClock().GetNow() : timestamp;
+
+			//Nachrichten, die vor Start entstanden sind, zählen ab Start
+			return time > start_ ? time - start_ : Misc::Clock::Duration(0);
+		}
+		//---------------------------------------------------------------------------
+	}
+}
@@ -0,0 +1,65 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_INPUT_INPUTRECORDER_HPP
+#define OSHGUI_INPUT_INPUTRECORDER_HPP
+
+#include "../Exports.hpp"
+#include "InputRecording.hpp"
+
+namespace OSHGui
+{
+	namespace Input
+	{
+		/**
+		 * Zeichnet alle Nachrichten auf, die an die Application gehen, und markiert jeden
+		 * Aufruf von Application::Render als Frame-Grenze. Wird mit
+		 * Application::SetInputRecorder angemeldet.
+		 */
+		class OSHGUI_EXPORT InputRecorder
+		{
+		public:
+			InputRecorder();
+
+			/**
+			 * Verwirft die bisherige Aufzeichnung und beginnt eine neue.
+			 */
+			void Start();
+			/**
+			 * Beendet die Aufzeichnung.
+			 */
+			void Stop();
+			/**
+			 * Ruft ab, ob gerade aufgezeichnet wird.
+			 *
+			 * \return ja / nein
+			 */
+			bool IsRecording() const;
+
+			/**
+			 * Ruft die Aufzeichnung ab.
+			 *
+			 * \return recording
+			 */
+			const InputRecording& GetRecording() const;
+
+			void RecordMouseMessage(const MouseMessage &mouse);
+			void RecordKeyboardMessage(const KeyboardMessage &keyboard);
+			void RecordFrame();
+
+		private:
+			Misc::Clock::Duration GetOffset(const Misc::Clock::TimePoint &timestamp) const;
+
+			InputRecording recording_;
+			Misc::Clock::TimePoint start_;
+			bool isRecording_;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,176 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "InputRecording.hpp"
+#include "../Misc/MemoryMappedFile.hpp"
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+namespace OSHGui
+{
+	namespace Input
+	{
+		namespace
+		{
+			const uint32_t Magic = 0x5249534F; //OSIR
+			const uint32_t Version = 1;
+
+			//feste Breiten, damit Aufzeichnungen zwischen 32 und 64 Bit austauschbar sind
+			struct StoredEntry
+			{
+				uint8_t Type;
+				uint8_t State;
+				uint8_t Button;
+				int8_t KeyChar;
+				uint32_t KeyData;
+				int32_t X;
+				int32_t Y;
+				int32_t Delta;
+				int64_t Offset;
+			};
+			//---------------------------------------------------------------------------
+			template<typename T>
+			bool Read(const Misc::MemoryMappedFile &file, size_t &position, T &value)
+			{
+				if (position + sizeof(T) > file.GetSize())
+				{
+					return false;
+				}
+				std::memcpy(&value, file.GetDataPointer() + position, sizeof(T));
+				position += sizeof(T);
+				return true;
+			}
+			//---------------------------------------------------------------------------
+			template<typename T>
+			void Write(std::ofstream &out, const T &value)
+			{
+				out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+			}
+		}
+		//---------------------------------------------------------------------------
+		//Getter/Setter
+		//---------------------------------------------------------------------------
+		const std::vector<InputRecording::Entry>& InputRecording::GetEntries() const
+		{
+			return entries_;
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		void InputRecording::AddMouseMessage(const Misc::Clock::Duration &offset, const MouseMessage &mouse)
+		{
+			Entry entry = { EntryType::Mouse, offset, mouse, KeyboardMessage() };
+			entries_.push_back(entry);
+		}
+		//---------------------------------------------------------------------------
+		void InputRecording::AddKeyboardMessage(const Misc::Clock::Duration &offset, const KeyboardMessage &keyboard)
+		{
+			Entry entry = { EntryType::Keyboard, offset, MouseMessage(), keyboard };
+			entries_.push_back(entry);
+		}
+		//---------------------------------------------------------------------------
+		void InputRecording::AddFrame(const Misc::Clock::Duration &offset)
+		{
+			Entry entry = { EntryType::Frame, offset, MouseMessage(), KeyboardMessage() };
+			entries_.push_back(entry);
+		}
+		//---------------------------------------------------------------------------
+		void InputRecording::Clear()
+		{
+			entries_.clear();
+		}
+		//---------------------------------------------------------------------------
+		bool InputRecording::Load(const Misc::AnsiString &file)
+		{
+			Misc::MemoryMappedFile mapping;
+			if (!mapping.Open(file))
+			{
+				return false;
+			}
+
+			size_t position = 0;
+			uint32_t magic, version, count;
+			if (!Read(mapping, position, magic) || magic != Magic || !Read(mapping, position, version) || version != Version || !Read(mapping, position, count))
+			{
+				return false;
+			}
+
+			//eine beschädigte Anzahl darf keine riesige Reservierung auslösen
+			if (count > (mapping.GetSize() - position) / sizeof(StoredEntry))
+			{
+				return false;
+			}
+
+			std::vector<Entry> entries;
+			entries.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+			{
+				StoredEntry stored;
+				if (!Read(mapping, position, stored) || stored.Type > static_cast<uint8_t>(EntryType::Frame))
+				{
+					return false;
+				}
+
+				Entry entry = { static_cast<EntryType>(stored.Type), Misc::Clock::Duration(stored.Offset), MouseMessage(), KeyboardMessage() };
+				if (entry.Type == EntryType::Mouse)
+				{
+					entry.Mouse = MouseMessage(static_cast<MouseState>(stored.State), static_cast<MouseButton>(stored.Button), Drawing::PointI(stored.X, stored.Y), stored.Delta);
+				}
+				else if (entry.Type == EntryType::Keyboard)
+				{
+					entry.Keyboard = KeyboardMessage(static_cast<KeyboardState>(stored.State), static_cast<Key>(stored.KeyData), static_cast<Misc::AnsiChar>(stored.KeyChar));
+				}
+				entries.push_back(entry);
+			}
+
+			entries_ = std::move(entries);
+
+			return true;
+		}
+		//---------------------------------------------------------------------------
+		bool InputRecording::Save(const Misc::AnsiString &file) const
+		{
+			std::ofstream out(file, std::ios::binary | std::ios::trunc);
+			if (!out)
+			{
+				return false;
+			}
+
+			Write(out, Magic);
+			Write(out, Version);
+			Write(out, static_cast<uint32_t>(entries_.size()));
+			for (auto &entry : entries_)
+			{
+				StoredEntry stored;
+				std::memset(&stored, 0, sizeof(stored));
+				stored.Type = static_cast<uint8_t>(entry.Type);
+				stored.Offset = static_cast<int64_t>(entry.Offset.count());
+				if (entry.Type == EntryType::Mouse)
+				{
+					stored.State = static_cast<uint8_t>(entry.Mouse.GetState());
+					stored.Button = static_cast<uint8_t>(entry.Mouse.GetButton());
+					stored.X = entry.Mouse.GetLocation().X;
+					stored.Y = entry.Mouse.GetLocation().Y;
+					stored.Delta = entry.Mouse.GetDelta();
+				}
+				else if (entry.Type == EntryType::Keyboard)
+				{
+					stored.State = static_cast<uint8_t>(entry.Keyboard.GetState());
+					stored.KeyData = static_cast<uint32_t>(entry.Keyboard.GetKeyData());
+					stored.KeyChar = static_cast<int8_t>(entry.Keyboard.GetKeyChar());
+				}
+				Write(out, stored);
+			}
+
+			return static_cast<bool>(out);
+		}
+		//---------------------------------------------------------------------------
+	}
+}
@@ -0,0 +1,85 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_INPUT_INPUTRECORDING_HPP
+#define OSHGUI_INPUT_INPUTRECORDING_HPP
+
+#include <vector>
+#include "../Exports.hpp"
+#include "../Misc/Strings.hpp"
+#include "../Misc/Clock.hpp"
+#include "../Event/MouseMessage.hpp"
+#include "../Event/KeyboardMessage.hpp"
+
+namespace OSHGui
+{
+	namespace Input
+	{
+		/**
+		 * Eine aufgezeichnete Folge von Maus- und Tastaturnachrichten sowie Frame-Grenzen,
+		 * jeweils mit dem Abstand zum Beginn der Aufzeichnung.
+		 */
+		class OSHGUI_EXPORT InputRecording
+		{
+		public:
+			enum class EntryType
+			{
+				Mouse,
+				Keyboard,
+				/**
+				 * Application::Render wurde aufgerufen.
+				 */
+				Frame
+			};
+
+			struct Entry
+			{
+				EntryType Type;
+				Misc::Clock::Duration Offset;
+				MouseMessage Mouse;
+				KeyboardMessage Keyboard;
+			};
+
+			void AddMouseMessage(const Misc::Clock::Duration &offset, const MouseMessage &mouse);
+			void AddKeyboardMessage(const Misc::Clock::Duration &offset, const KeyboardMessage &keyboard);
+			void AddFrame(const Misc::Clock::Duration &offset);
+
+			/**
+			 * Ruft die aufgezeichneten Einträge in zeitlicher Reihenfolge ab.
+			 *
+			 * \return entries
+			 */
+			const std::vector<Entry>& GetEntries() const;
+			/**
+			 * Entfernt alle Einträge.
+			 */
+			void Clear();
+
+			/**
+			 * Lädt eine gespeicherte Aufzeichnung. Schlägt das Laden fehl, bleibt die
+			 * Aufzeichnung unverändert.
+			 *
+			 * \param file
+			 * \return false, falls die Datei nicht gelesen werden konnte
+			 */
+			bool Load(const Misc::AnsiString &file);
+			/**
+			 * Speichert die Aufzeichnung.
+			 *
+			 * \param file
+			 * \return false, falls die Datei nicht geschrieben werden konnte
+			 */
+			bool Save(const Misc::AnsiString &file) const;
+
+		private:
+			std::vector<Entry> entries_;
+		};
+	}
+}
+
+#endif
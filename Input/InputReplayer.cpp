@@ -0,0 +1,154 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "InputReplayer.hpp"
+#include "../Application.hpp"
+
+namespace OSHGui
+{
+	namespace Input
+	{
+		//---------------------------------------------------------------------------
+		//Constructor
+		//---------------------------------------------------------------------------
+		InputReplayer::InputReplayer(const InputRecording &recording, Speed speed)
+			: recording_(recording),
+			  speed_(speed),
+			  position_(0),
+			  isStarted_(false)
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		InputReplayer::~InputReplayer()
+		{
+			if (Application::HasBeenInitialized())
+			{
+				Stop();
+			}
+		}
+		//---------------------------------------------------------------------------
+		//Getter/Setter
+		//---------------------------------------------------------------------------
+		void InputReplayer::SetSpeed(Speed speed)
+		{
+			speed_ = speed;
+			isStarted_ = false;
+		}
+		//---------------------------------------------------------------------------
+		InputReplayer::Speed InputReplayer::GetSpeed() const
+		{
+			return speed_;
+		}
+		//---------------------------------------------------------------------------
+		bool InputReplayer::IsFinished() const
+		{
+			return position_ >= recording_.GetEntries().size();
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		void InputReplayer::Restart()
+		{
+			position_ = 0;
+			isStarted_ = false;
+		}
+		//---------------------------------------------------------------------------
+		void InputReplayer::Start()
+		{
+			auto &app = Application::Instance();
+			if (!clock_)
+			{
+				previousClock_ = app.GetSharedClock();
+				clock_ = std::make_shared<Misc::ManualClock>(app.GetClock().GetNow());
+				app.SetClock(clock_);
+			}
+
+			//nach einem Neustart oder Geschwindigkeitswechsel geht es ab der aktuellen Position weiter
+			const auto offset = recording_.GetEntries()[position_].Offset;
+			start_ = clock_->GetNow() - offset;
+			wallStart_ = Misc::SteadyClock().GetNow() - offset;
+			isStarted_ = true;
+		}
+		//---------------------------------------------------------------------------
+		void InputReplayer::Stop()
+		{
+			if (clock_)
+			{
+				Application::Instance().SetClock(previousClock_);
+
+				clock_.reset();
+				previousClock_.reset();
+			}
+			isStarted_ = false;
+		}
+		//---------------------------------------------------------------------------
+		void InputReplayer::Update()
+		{
+			const auto &entries = recording_.GetEntries();
+			if (position_ >= entries.size())
+			{
+				//erst nach dem Render des letzten Frames wieder die vorherige Zeitquelle verwenden
+				Stop();
+				return;
+			}
+
+			if (!isStarted_)
+			{
+				Start();
+			}
+
+			//höchstens ein aufgezeichneter Frame pro Update, damit jedes Render denselben Zeitpunkt sieht wie bei der Aufnahme
+			const auto elapsed = Misc::SteadyClock().GetNow() - wallStart_;
+			for (; position_ < entries.size(); ++position_)
+			{
+				const auto &entry = entries[position_];
+				if (speed_ == Speed::Recorded && entry.Offset > elapsed)
+				{
+					return;
+				}
+
+				clock_->SetNow(start_ + entry.Offset);
+
+				if (entry.Type == InputRecording::EntryType::Frame)
+				{
+					++position_;
+					break;
+				}
+				Replay(entry);
+			}
+		}
+		//---------------------------------------------------------------------------
+		void InputReplayer::Replay(const InputRecording::Entry &entry)
+		{
+			//ohne Zeitstempel misst die Application die Latenz ab der Wiedergabe
+			switch (entry.Type)
+			{
+				case InputRecording::EntryType::Mouse:
+					if (enableMouseInput)
+					{
+						auto mouse = entry.Mouse;
+						mouse.SetTimestamp(Misc::Clock::TimePoint());
+						InjectMouseMessage(mouse);
+					}
+					break;
+				case InputRecording::EntryType::Keyboard:
+					if (enableKeyboardInput)
+					{
+						auto keyboard = entry.Keyboard;
+						keyboard.SetTimestamp(Misc::Clock::TimePoint());
+						InjectKeyboardMessage(keyboard);
+					}
+					break;
+				case InputRecording::EntryType::Frame:
+					break;
+			}
+		}
+		//---------------------------------------------------------------------------
+	}
+}
@@ -0,0 +1,90 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_INPUT_INPUTREPLAYER_HPP
+#define OSHGUI_INPUT_INPUTREPLAYER_HPP
+
+#include <cstddef>
+#include <memory>
+#include "Input.hpp"
+#include "InputRecording.hpp"
+
+namespace OSHGui
+{
+	namespace Input
+	{
+		/**
+		 * Plattformunabhängiger Input, der eine Aufzeichnung wieder an die Application gibt.
+		 * Update muss vor jedem Application::Render aufgerufen werden. Während der Wiedergabe
+		 * läuft die Application mit einer ManualClock, die auf die aufgezeichneten Zeitpunkte
+		 * gestellt wird. Timer, Animationen und Zeitüberschreitungen verhalten sich so wie bei
+		 * der Aufnahme. Am Ende wird die vorherige Zeitquelle wiederhergestellt.
+		 */
+		class OSHGUI_EXPORT InputReplayer : public Input
+		{
+		public:
+			enum class Speed
+			{
+				/**
+				 * Die Frames werden frühestens im aufgezeichneten zeitlichen Abstand weitergegeben.
+				 */
+				Recorded,
+				/**
+				 * Jedes Update gibt die Nachrichten eines aufgezeichneten Frames weiter,
+				 * unabhängig von der vergangenen Zeit.
+				 */
+				Maximal
+			};
+
+			/**
+			 * Konstruktor der Klasse.
+			 *
+			 * \param recording
+			 * \param speed
+			 */
+			InputReplayer(const InputRecording &recording, Speed speed = Speed::Recorded);
+			~InputReplayer();
+
+			void SetSpeed(Speed speed);
+			Speed GetSpeed() const;
+
+			/**
+			 * Ruft ab, ob alle Nachrichten weitergegeben wurden.
+			 *
+			 * \return ja / nein
+			 */
+			bool IsFinished() const;
+			/**
+			 * Beginnt die Wiedergabe von vorne.
+			 */
+			void Restart();
+			/**
+			 * Gibt die fälligen Nachrichten an die Application weiter.
+			 */
+			void Update();
+
+		private:
+			void Start();
+			void Stop();
+			void Replay(const InputRecording::Entry &entry);
+
+			InputRecording recording_;
+			Speed speed_;
+			std::size_t position_;
+			//Zeitpunkt der Aufnahme 0 auf der Uhr der Wiedergabe bzw. der echten Zeit
+			Misc::Clock::TimePoint start_;
+			Misc::Clock::TimePoint wallStart_;
+			bool isStarted_;
+
+			std::shared_ptr<Misc::ManualClock> clock_;
+			std::shared_ptr<Misc::Clock> previousClock_;
+		};
+	}
+}
+
+#endif
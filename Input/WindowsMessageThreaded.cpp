@@ -1,45 +1,129 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#include "WindowsMessageThreaded.hpp"
-#include "../Application.hpp"
-
-namespace OSHGui
-{
-	namespace Input
-	{
-		void WindowsMessageThreaded::PopulateMessages()
-		{
-			auto &app = Application::Instance();
-
-			while (!mouseMessages_.IsEmpty())
-			{
-				app.ProcessMouseMessage(mouseMessages_.Pop());
-			}
-			while (!keyboardMessages_.IsEmpty())
-			{
-				app.ProcessKeyboardMessage(keyboardMessages_.Pop());
-			}
-		}
-		//---------------------------------------------------------------------------
-		bool WindowsMessageThreaded::InjectMouseMessage(const MouseMessage &mouse)
-		{
-			mouseMessages_.Push(mouse);
-
-			return false;
-		}
-		//---------------------------------------------------------------------------
-		bool WindowsMessageThreaded::InjectKeyboardMessage(const KeyboardMessage &keyboard)
-		{
-			keyboardMessages_.Push(keyboard);
-
-			return false;
-		}
-		//---------------------------------------------------------------------------
-	}
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "WindowsMessageThreaded.hpp"
+#include "../Application.hpp"
+#include <thread>
+
+namespace OSHGui
+{
+	namespace Input
+	{
+		WindowsMessageThreaded::WindowsMessageThreaded(std::size_t capacity)
+			: mouseMessages_(capacity),
+			  coalesceMouseMessages_(true),
+			  coalescedMessageCount_(0),
+			  droppedMessageCount_(0)
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		void WindowsMessageThreaded::SetMouseCoalescingEnabled(bool enable)
+		{
+			coalesceMouseMessages_ = enable;
+		}
+		//---------------------------------------------------------------------------
+		bool WindowsMessageThreaded::GetMouseCoalescingEnabled() const
+		{
+			return coalesceMouseMessages_;
+		}
+		//---------------------------------------------------------------------------
+		unsigned long long WindowsMessageThreaded::GetCoalescedMessageCount() const
+		{
+			return coalescedMessageCount_;
+		}
+		//---------------------------------------------------------------------------
+		unsigned long long WindowsMessageThreaded::GetDroppedMessageCount() const
+		{
+			return droppedMessageCount_;
+		}
+		//---------------------------------------------------------------------------
+		void WindowsMessageThreaded::PopulateMessages()
+		{
+			auto &app = Application::Instance();
+
+			//höchstens eine volle Warteschlange pro Aufruf, damit ein schneller Schreiber den Aufrufer nicht aufhält
+			MouseMessage pending;
+			auto hasPending = false;
+			MouseMessage mouse;
+			for (auto i = mouseMessages_.GetCapacity(); i > 0 && mouseMessages_.TryPop(mouse); --i)
+			{
+				//aufeinanderfolgende Bewegungen bzw. Drehungen des Mausrads werden zusammengefasst,
+				//Tastendrücke bleiben einzeln und in ihrer Reihenfolge erhalten
+				if (hasPending && coalesceMouseMessages_ && pending.GetState() == mouse.GetState()
+					&& (mouse.GetState() == MouseState::Move || mouse.GetState() == MouseState::Scroll))
+				{
+					//die Latenz zählt ab der ältesten zusammengefassten Nachricht
+					pending = MouseMessage(mouse.GetState(), mouse.GetButton(), mouse.GetLocation(), pending.GetDelta() + mouse.GetDelta(), pending.GetTimestamp());
+					++coalescedMessageCount_;
+					continue;
+				}
+
+				if (hasPending)
+				{
+					app.ProcessMouseMessage(pending);
+				}
+				pending = mouse;
+				hasPending = true;
+			}
+			if (hasPending)
+			{
+				app.ProcessMouseMessage(pending);
+			}
+
+			KeyboardMessage keyboard;
+			while (keyboardMessages_.TryPop(keyboard))
+			{
+				app.ProcessKeyboardMessage(keyboard);
+			}
+		}
+		//---------------------------------------------------------------------------
+		bool WindowsMessageThreaded::InjectMouseMessage(const MouseMessage &mouse)
+		{
+			auto message = mouse;
+			if (message.GetTimestamp() == Misc::Clock::TimePoint())
+			{
+				//die Uhr der Anwendung darf nur im UI-Thread gelesen werden, die Latenz zählt aber ab dem Eintreffen
+				message.SetTimestamp(Misc::SteadyClock().GetNow());
+			}
+
+			if (!mouseMessages_.TryPush(message))
+			{
+				if (message.GetState() == MouseState::Move || message.GetState() == MouseState::Scroll)
+				{
+					//eine verlorene Bewegung holt die nächste nach, der Input-Thread wird nicht blockiert
+					++droppedMessageCount_;
+				}
+				else
+				{
+					//Tastendrücke dürfen nicht verloren gehen, notfalls wird gewartet
+					while (!mouseMessages_.TryPush(message))
+					{
+						std::this_thread::yield();
+					}
+				}
+			}
+
+			return false;
+		}
+		//---------------------------------------------------------------------------
+		bool WindowsMessageThreaded::InjectKeyboardMessage(const KeyboardMessage &keyboard)
+		{
+			auto message = keyboard;
+			if (message.GetTimestamp() == Misc::Clock::TimePoint())
+			{
+				message.SetTimestamp(Misc::SteadyClock().GetNow());
+			}
+
+			keyboardMessages_.Push(std::move(message));
+
+			return false;
+		}
+		//---------------------------------------------------------------------------
+	}
 }
\ No newline at end of file
@@ -1,42 +1,88 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * See license in OSHGui.hpp
- */
-
-#ifndef OSHGUI_INPUT_WINDOWSMESSAGETRHEADED_HPP
-#define OSHGUI_INPUT_WINDOWSMESSAGETRHEADED_HPP
-
-#include "WindowsMessage.hpp"
-#include "../Misc/ConcurrendQueue.hpp"
-#include "../Event/MouseMessage.hpp"
-#include "../Event/KeyboardMessage.hpp"
-
-namespace OSHGui
-{
-	namespace Input
-	{
-		/**
-		 * Verwaltet den Input unter Windows und gibt diesen threadsafe an die Application weiter.
-		 */
-		class OSHGUI_EXPORT WindowsMessageThreaded : public WindowsMessage
-		{
-		public:
-			void PopulateMessages();
-
-		protected:
-			virtual bool InjectMouseMessage(const MouseMessage &mouse) override;
-			virtual bool InjectKeyboardMessage(const KeyboardMessage &keyboard) override;
-
-		private:
-			typedef Misc::ConcurrendQueue<MouseMessage> MouseMessageQueue;
-			MouseMessageQueue mouseMessages_;
-			typedef Misc::ConcurrendQueue<KeyboardMessage> KeyboardMessageQueue;
-			KeyboardMessageQueue keyboardMessages_;
-		};
-	}
-}
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_INPUT_WINDOWSMESSAGETRHEADED_HPP
+#define OSHGUI_INPUT_WINDOWSMESSAGETRHEADED_HPP
+
+#include <atomic>
+#include "WindowsMessage.hpp"
+#include "../Misc/MpscQueue.hpp"
+#include "../Misc/ConcurrendQueue.hpp"
+#include "../Event/MouseMessage.hpp"
+#include "../Event/KeyboardMessage.hpp"
+
+namespace OSHGui
+{
+	namespace Input
+	{
+		/**
+		 * Verwaltet den Input unter Windows und gibt diesen threadsafe an die Application weiter.
+		 */
+		class OSHGUI_EXPORT WindowsMessageThreaded : public WindowsMessage
+		{
+		public:
+			/**
+			 * Konstruktor der Klasse.
+			 *
+			 * \param capacity maximale Anzahl der wartenden Mausnachrichten (Zweierpotenz). Tastaturnachrichten sind nicht begrenzt.
+			 */
+			explicit WindowsMessageThreaded(std::size_t capacity = 1024);
+
+			/**
+			 * Gibt die gesammelten Nachrichten an die Application weiter. Muss im Thread
+			 * aufgerufen werden, der auch Application::Render aufruft.
+			 */
+			void PopulateMessages();
+
+			/**
+			 * Legt fest, ob aufeinanderfolgende Mausbewegungen und Mausrad-Nachrichten in
+			 * PopulateMessages zu einer Nachricht zusammengefasst werden.
+			 *
+			 * \param enable
+			 */
+			void SetMouseCoalescingEnabled(bool enable);
+			/**
+			 * Ruft ab, ob Mausnachrichten zusammengefasst werden.
+			 *
+			 * \return ja / nein
+			 */
+			bool GetMouseCoalescingEnabled() const;
+			/**
+			 * Ruft die Anzahl der Mausnachrichten ab, die bisher zusammengefasst und daher
+			 * nicht einzeln verarbeitet wurden.
+			 *
+			 * \return count
+			 */
+			unsigned long long GetCoalescedMessageCount() const;
+			/**
+			 * Ruft die Anzahl der Mausbewegungen und Mausrad-Nachrichten ab, die verworfen wurden, weil
+			 * die Warteschlange voll war. Tastendrücke und Tastaturnachrichten gehen nie verloren.
+			 *
+			 * \return count
+			 */
+			unsigned long long GetDroppedMessageCount() const;
+
+		protected:
+			virtual bool InjectMouseMessage(const MouseMessage &mouse) override;
+			virtual bool InjectKeyboardMessage(const KeyboardMessage &keyboard) override;
+
+		private:
+			typedef Misc::MpscQueue<MouseMessage> MouseMessageQueue;
+			MouseMessageQueue mouseMessages_;
+			//ein verlorenes KeyUp würde eine Taste hängen lassen, daher unbegrenzt
+			typedef Misc::ConcurrendQueue<KeyboardMessage> KeyboardMessageQueue;
+			KeyboardMessageQueue keyboardMessages_;
+
+			bool coalesceMouseMessages_;
+			unsigned long long coalescedMessageCount_;
+			std::atomic<unsigned long long> droppedMessageCount_;
+		};
+	}
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "Clock.hpp"
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		//---------------------------------------------------------------------------
+		//Clock
+		//---------------------------------------------------------------------------
+		Clock::~Clock()
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		//SteadyClock
+		//---------------------------------------------------------------------------
+		Clock::TimePoint SteadyClock::GetNow() const
+		{
+			return std::chrono::time_point_cast<Duration>(std::chrono::steady_clock::now());
+		}
+		//---------------------------------------------------------------------------
+		//ManualClock
+		//---------------------------------------------------------------------------
+		ManualClock::ManualClock(TimePoint now)
+			: now_(now)
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		Clock::TimePoint ManualClock::GetNow() const
+		{
+			return now_;
+		}
+		//---------------------------------------------------------------------------
+		void ManualClock::SetNow(TimePoint now)
+		{
+			now_ = now;
+		}
+		//---------------------------------------------------------------------------
+		void ManualClock::Advance(Duration duration)
+		{
+			now_ += duration;
+		}
+		//---------------------------------------------------------------------------
+	}
+}
@@ -0,0 +1,82 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_MISC_CLOCK_HPP
+#define OSHGUI_MISC_CLOCK_HPP
+
+#include <chrono>
+#include "../Exports.hpp"
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		/**
+		 * Monotone Zeitquelle mit Nanosekunden-Auflösung. Die Zeitpunkte sind nur
+		 * untereinander vergleichbar und entsprechen keiner Uhrzeit.
+		 */
+		class OSHGUI_EXPORT Clock
+		{
+		public:
+			typedef std::chrono::nanoseconds Duration;
+			typedef std::chrono::time_point<std::chrono::steady_clock, Duration> TimePoint;
+
+			virtual ~Clock();
+
+			/**
+			 * Ruft den aktuellen Zeitpunkt ab.
+			 *
+			 * \return now
+			 */
+			virtual TimePoint GetNow() const = 0;
+		};
+
+		/**
+		 * Zeitquelle auf Basis von std::chrono::steady_clock.
+		 */
+		class OSHGUI_EXPORT SteadyClock : public Clock
+		{
+		public:
+			virtual TimePoint GetNow() const override;
+		};
+
+		/**
+		 * Zeitquelle, die nur manuell weitergestellt wird. Ermöglicht reproduzierbare
+		 * Tests und Benchmarks von zeitabhängigem Verhalten.
+		 */
+		class OSHGUI_EXPORT ManualClock : public Clock
+		{
+		public:
+			/**
+			 * Konstruktor der Klasse.
+			 *
+			 * \param now der Startzeitpunkt
+			 */
+			explicit ManualClock(TimePoint now = TimePoint());
+
+			virtual TimePoint GetNow() const override;
+			/**
+			 * Legt den aktuellen Zeitpunkt fest.
+			 *
+			 * \param now
+			 */
+			void SetNow(TimePoint now);
+			/**
+			 * Stellt die Zeit um die angegebene Dauer weiter.
+			 *
+			 * \param duration
+			 */
+			void Advance(Duration duration);
+
+		private:
+			TimePoint now_;
+		};
+	}
+}
+
+#endif
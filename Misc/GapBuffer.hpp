@@ -0,0 +1,149 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_MISC_GAPBUFFER_HPP
+#define OSHGUI_MISC_GAPBUFFER_HPP
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		/**
+		 * Sequenz mit einer Lücke an der zuletzt bearbeiteten Stelle. Einfügen und Löschen
+		 * in der Nähe der Lücke kostet O(1), nur das Verschieben der Lücke ist linear
+		 * zur zurückgelegten Strecke.
+		 */
+		template<typename T>
+		class GapBuffer
+		{
+		public:
+			static const std::size_t DefaultGapSize = 64;
+
+			/**
+			 * Konstruktor der Klasse.
+			 */
+			GapBuffer()
+				: gapStart_(0),
+				  gapEnd_(0)
+			{
+
+			}
+
+			/**
+			 * Ruft die Anzahl der Elemente ab.
+			 *
+			 * \return size
+			 */
+			std::size_t GetSize() const
+			{
+				return buffer_.size() - (gapEnd_ - gapStart_);
+			}
+			/**
+			 * Ruft ab, ob der Puffer leer ist.
+			 *
+			 * \return ja / nein
+			 */
+			bool IsEmpty() const
+			{
+				return GetSize() == 0;
+			}
+
+			T& operator[](std::size_t index)
+			{
+				return buffer_[index < gapStart_ ? index : index + (gapEnd_ - gapStart_)];
+			}
+			const T& operator[](std::size_t index) const
+			{
+				return buffer_[index < gapStart_ ? index : index + (gapEnd_ - gapStart_)];
+			}
+
+			/**
+			 * Fügt ein Element an der angegebenen Position ein.
+			 *
+			 * \param index
+			 * \param value
+			 */
+			void Insert(std::size_t index, T value)
+			{
+				MoveGap(index);
+				if (gapStart_ == gapEnd_)
+				{
+					GrowGap(buffer_.size() / 2 > DefaultGapSize ? buffer_.size() / 2 : DefaultGapSize);
+				}
+
+				buffer_[gapStart_++] = std::move(value);
+			}
+			/**
+			 * Entfernt Elemente ab der angegebenen Position.
+			 *
+			 * \param index
+			 * \param count
+			 */
+			void Erase(std::size_t index, std::size_t count = 1)
+			{
+				MoveGap(index);
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					buffer_[gapEnd_++] = T();
+				}
+			}
+			/**
+			 * Entfernt alle Elemente.
+			 */
+			void Clear()
+			{
+				buffer_.clear();
+				gapStart_ = gapEnd_ = 0;
+			}
+
+		private:
+			void MoveGap(std::size_t index)
+			{
+				if (gapStart_ == gapEnd_)
+				{
+					//ohne Lücke wäre das Verschieben eine Selbstzuweisung
+					gapStart_ = gapEnd_ = index;
+				}
+				else if (index < gapStart_)
+				{
+					const auto count = gapStart_ - index;
+					std::move_backward(buffer_.begin() + index, buffer_.begin() + gapStart_, buffer_.begin() + gapEnd_);
+					gapStart_ -= count;
+					gapEnd_ -= count;
+				}
+				else if (index > gapStart_)
+				{
+					const auto count = index - gapStart_;
+					std::move(buffer_.begin() + gapEnd_, buffer_.begin() + gapEnd_ + count, buffer_.begin() + gapStart_);
+					gapStart_ += count;
+					gapEnd_ += count;
+				}
+			}
+
+			void GrowGap(std::size_t size)
+			{
+				const auto tail = buffer_.size() - gapEnd_;
+
+				buffer_.resize(buffer_.size() + size);
+				std::move_backward(buffer_.begin() + gapEnd_, buffer_.begin() + gapEnd_ + tail, buffer_.end());
+
+				gapEnd_ += size;
+			}
+
+			std::vector<T> buffer_;
+			std::size_t gapStart_;
+			std::size_t gapEnd_;
+		};
+	}
+}
+
+#endif
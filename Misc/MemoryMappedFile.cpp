@@ -0,0 +1,144 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "MemoryMappedFile.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		MemoryMappedFile::MemoryMappedFile()
+			: data_(nullptr),
+			  size_(0)
+			  #ifdef _WIN32
+			  , file_(INVALID_HANDLE_VALUE),
+			  mapping_(nullptr)
+			  #endif
+		{
+
+		}
+		//---------------------------------------------------------------------------
+		MemoryMappedFile::~MemoryMappedFile()
+		{
+			Close();
+		}
+		//---------------------------------------------------------------------------
+		bool MemoryMappedFile::IsOpen() const
+		{
+			return data_ != nullptr;
+		}
+		//---------------------------------------------------------------------------
+		const uint8_t* MemoryMappedFile::GetDataPointer() const
+		{
+			return data_;
+		}
+		//---------------------------------------------------------------------------
+		size_t MemoryMappedFile::GetSize() const
+		{
+			return size_;
+		}
+		//---------------------------------------------------------------------------
+		bool MemoryMappedFile::Open(const Misc::AnsiString &filename)
+		{
+			Close();
+
+			#ifdef _WIN32
+			file_ = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file_ == INVALID_HANDLE_VALUE)
+			{
+				return false;
+			}
+
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0)
+			{
+				Close();
+				return false;
+			}
+
+			mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mapping_ == nullptr)
+			{
+				Close();
+				return false;
+			}
+
+			data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+			if (data_ == nullptr)
+			{
+				Close();
+				return false;
+			}
+			size_ = static_cast<size_t>(size.QuadPart);
+			#else
+			const auto file = open(filename.c_str(), O_RDONLY);
+			if (file == -1)
+			{
+				return false;
+			}
+
+			struct stat info;
+			if (fstat(file, &info) != 0 || info.st_size == 0)
+			{
+				close(file);
+				return false;
+			}
+
+			const auto data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+			close(file);
+			if (data == MAP_FAILED)
+			{
+				return false;
+			}
+
+			data_ = static_cast<const uint8_t*>(data);
+			size_ = static_cast<size_t>(info.st_size);
+			#endif
+
+			return true;
+		}
+		//---------------------------------------------------------------------------
+		void MemoryMappedFile::Close()
+		{
+			#ifdef _WIN32
+			if (data_ != nullptr)
+			{
+				UnmapViewOfFile(data_);
+			}
+			if (mapping_ != nullptr)
+			{
+				CloseHandle(mapping_);
+				mapping_ = nullptr;
+			}
+			if (file_ != INVALID_HANDLE_VALUE)
+			{
+				CloseHandle(file_);
+				file_ = INVALID_HANDLE_VALUE;
+			}
+			#else
+			if (data_ != nullptr)
+			{
+				munmap(const_cast<uint8_t*>(data_), size_);
+			}
+			#endif
+
+			data_ = nullptr;
+			size_ = 0;
+		}
+		//---------------------------------------------------------------------------
+	}
+}
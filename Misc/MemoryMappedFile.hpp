@@ -0,0 +1,62 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_MISC_MEMORYMAPPEDFILE_HPP
+#define OSHGUI_MISC_MEMORYMAPPEDFILE_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include "../Exports.hpp"
+#include "Strings.hpp"
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		/**
+		 * Blendet eine Datei schreibgeschützt in den Speicher ein.
+		 */
+		class OSHGUI_EXPORT MemoryMappedFile
+		{
+		public:
+			MemoryMappedFile();
+			~MemoryMappedFile();
+
+			/**
+			 * Öffnet die Datei und blendet sie in den Speicher ein.
+			 *
+			 * \param filename
+			 * \return false, falls die Datei nicht geöffnet werden konnte
+			 */
+			bool Open(const Misc::AnsiString &filename);
+			/**
+			 * Schließt die Datei.
+			 */
+			void Close();
+
+			bool IsOpen() const;
+
+			const uint8_t* GetDataPointer() const;
+			size_t GetSize() const;
+
+		private:
+			//copying prohibited
+			MemoryMappedFile(const MemoryMappedFile&);
+			void operator=(const MemoryMappedFile&);
+
+			const uint8_t *data_;
+			size_t size_;
+			#ifdef _WIN32
+			void *file_;
+			void *mapping_;
+			#endif
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "MemoryPool.hpp"
+#include <new>
+#include <array>
+#include <atomic>
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		//---------------------------------------------------------------------------
+		//Constructor
+		//---------------------------------------------------------------------------
+		MemoryPool::MemoryPool(std::size_t blockSize, std::size_t blocksPerChunk)
+			: blockSize_(blockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : blockSize),
+			  blocksPerChunk_(blocksPerChunk > 0 ? blocksPerChunk : 1),
+			  usedBlockCount_(0),
+			  freeList_(nullptr)
+		{
+			//jeder Block muss für beliebige Objekte ausgerichtet sein
+			const auto alignment = alignof(std::max_align_t);
+			blockSize_ = (blockSize_ + alignment - 1) / alignment * alignment;
+		}
+		//---------------------------------------------------------------------------
+		//Getter/Setter
+		//---------------------------------------------------------------------------
+		std::size_t MemoryPool::GetBlockSize() const
+		{
+			return blockSize_;
+		}
+		//---------------------------------------------------------------------------
+		std::size_t MemoryPool::GetUsedBlockCount() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			return usedBlockCount_;
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		void* MemoryPool::Allocate()
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			if (freeList_ == nullptr)
+			{
+				//new char[] liefert Speicher, der für jeden Typ ausgerichtet ist
+				std::unique_ptr<char[]> chunk(new char[blockSize_ * blocksPerChunk_]);
+				for (auto i = blocksPerChunk_; i > 0; --i)
+				{
+					auto block = reinterpret_cast<FreeBlock*>(chunk.get() + (i - 1) * blockSize_);
+					block->Next = freeList_;
+					freeList_ = block;
+				}
+				chunks_.push_back(std::move(chunk));
+			}
+
+			auto block = freeList_;
+			freeList_ = block->Next;
+			++usedBlockCount_;
+
+			return block;
+		}
+		//---------------------------------------------------------------------------
+		void MemoryPool::Deallocate(void *block)
+		{
+			if (block == nullptr)
+			{
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			auto freeBlock = static_cast<FreeBlock*>(block);
+			freeBlock->Next = freeList_;
+			freeList_ = freeBlock;
+			--usedBlockCount_;
+		}
+		//---------------------------------------------------------------------------
+		MemoryPool* MemoryPool::GetSizeClassPool(std::size_t size)
+		{
+			const auto sizeClass = (size + SizeClassGranularity - 1) / SizeClassGranularity;
+			if (sizeClass == 0 || sizeClass > SizeClassCount)
+			{
+				return nullptr;
+			}
+
+			//die Pools werden absichtlich nie freigegeben, da Steuerelemente auch noch beim Beenden
+			//des Programms (z.B. aus statischen Objekten) gelöscht werden können
+			static auto pools = new std::array<std::atomic<MemoryPool*>, SizeClassCount>();
+			static std::mutex mutex;
+
+			auto &pool = (*pools)[sizeClass - 1];
+			auto instance = pool.load(std::memory_order_acquire);
+			if (instance == nullptr)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				instance = pool.load(std::memory_order_relaxed);
+				if (instance == nullptr)
+				{
+					const auto blockSize = sizeClass * SizeClassGranularity;
+					//etwa 16 KB pro Stück, aber mindestens 4 Blöcke
+					instance = new MemoryPool(blockSize, blockSize < 4096 ? 16384 / blockSize : 4);
+					pool.store(instance, std::memory_order_release);
+				}
+			}
+			return instance;
+		}
+		//---------------------------------------------------------------------------
+		void* MemoryPool::AllocateSized(std::size_t size)
+		{
+			if (auto pool = GetSizeClassPool(size))
+			{
+				return pool->Allocate();
+			}
+			return ::operator new(size);
+		}
+		//---------------------------------------------------------------------------
+		void MemoryPool::DeallocateSized(void *memory, std::size_t size)
+		{
+			if (auto pool = GetSizeClassPool(size))
+			{
+				pool->Deallocate(memory);
+			}
+			else
+			{
+				::operator delete(memory);
+			}
+		}
+		//---------------------------------------------------------------------------
+	}
+}
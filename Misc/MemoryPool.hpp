@@ -0,0 +1,105 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_MISC_MEMORYPOOL_HPP
+#define OSHGUI_MISC_MEMORYPOOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "../Exports.hpp"
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		/**
+		 * Verwaltet Speicherblöcke fester Größe. Die Blöcke werden in größeren Stücken
+		 * angefordert und nach der Freigabe über eine Freiliste wiederverwendet, der Speicher
+		 * geht erst mit dem Pool zurück an das System.
+		 */
+		class OSHGUI_EXPORT MemoryPool
+		{
+		public:
+			/**
+			 * Konstruktor der Klasse.
+			 *
+			 * \param blockSize Größe eines Blocks in Bytes
+			 * \param blocksPerChunk Anzahl der Blöcke, die auf einmal angefordert werden
+			 */
+			MemoryPool(std::size_t blockSize, std::size_t blocksPerChunk);
+
+			/**
+			 * Ruft die Größe eines Blocks ab.
+			 *
+			 * \return blockSize
+			 */
+			std::size_t GetBlockSize() const;
+			/**
+			 * Ruft die Anzahl der ausgegebenen Blöcke ab.
+			 *
+			 * \return count
+			 */
+			std::size_t GetUsedBlockCount() const;
+
+			/**
+			 * Fordert einen Block an.
+			 *
+			 * \return block
+			 */
+			void* Allocate();
+			/**
+			 * Gibt einen Block zurück, der mit Allocate angefordert wurde.
+			 *
+			 * \param block
+			 */
+			void Deallocate(void *block);
+
+			/**
+			 * Fordert Speicher aus dem Pool der passenden Größenklasse an. Zu große
+			 * Anforderungen werden an operator new weitergereicht.
+			 *
+			 * \param size
+			 * \return memory
+			 */
+			static void* AllocateSized(std::size_t size);
+			/**
+			 * Gibt Speicher zurück, der mit AllocateSized angefordert wurde.
+			 *
+			 * \param memory
+			 * \param size die bei AllocateSized angegebene Größe
+			 */
+			static void DeallocateSized(void *memory, std::size_t size);
+
+		private:
+			//copying prohibited
+			MemoryPool(const MemoryPool&);
+			void operator=(const MemoryPool&);
+
+			static const std::size_t SizeClassGranularity = 64;
+			static const std::size_t SizeClassCount = 64;
+
+			static MemoryPool* GetSizeClassPool(std::size_t size);
+
+			struct FreeBlock
+			{
+				FreeBlock *Next;
+			};
+
+			std::size_t blockSize_;
+			std::size_t blocksPerChunk_;
+			std::size_t usedBlockCount_;
+			std::vector<std::unique_ptr<char[]>> chunks_;
+			FreeBlock *freeList_;
+			mutable std::mutex mutex_;
+		};
+	}
+}
+
+#endif
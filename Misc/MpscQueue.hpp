@@ -0,0 +1,190 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_MISC_MPSCQUEUE_HPP
+#define OSHGUI_MISC_MPSCQUEUE_HPP
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+#include "Exceptions.hpp"
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		/**
+		 * Begrenzte Warteschlange für beliebig viele schreibende und genau einen lesenden Thread.
+		 * Push kommt ohne Lock aus, Pop ist zusätzlich wait-free. Jeder Platz trägt eine
+		 * Sequenznummer, an der Schreiber und Leser erkennen, ob er frei bzw. gefüllt ist.
+		 */
+		template<typename T>
+		class MpscQueue
+		{
+		public:
+			/**
+			 * Konstruktor der Klasse.
+			 *
+			 * \param capacity Anzahl der Plätze, muss eine Zweierpotenz sein
+			 */
+			explicit MpscQueue(std::size_t capacity)
+				: slots_(new Slot[capacity]),
+				  mask_(capacity - 1),
+				  tail_(0),
+				  head_(0)
+			{
+				#ifndef OSHGUI_DONTUSEEXCEPTIONS
+				if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+				{
+					throw ArgumentOutOfRangeException("capacity");
+				}
+				#endif
+
+				for (std::size_t i = 0; i < capacity; ++i)
+				{
+					slots_[i].Sequence.store(i, std::memory_order_relaxed);
+				}
+			}
+			~MpscQueue()
+			{
+				for (auto head = head_.load(std::memory_order_relaxed); ; ++head)
+				{
+					auto &slot = slots_[head & mask_];
+					if (slot.Sequence.load(std::memory_order_acquire) != head + 1)
+					{
+						break;
+					}
+					reinterpret_cast<T*>(&slot.Storage)->~T();
+				}
+			}
+
+			/**
+			 * Ruft die Anzahl der Plätze ab.
+			 *
+			 * \return capacity
+			 */
+			std::size_t GetCapacity() const
+			{
+				return mask_ + 1;
+			}
+			/**
+			 * Ruft ab, ob die Warteschlange leer ist. Das Ergebnis ist nur eine Momentaufnahme.
+			 *
+			 * \return ja / nein
+			 */
+			bool IsEmpty() const
+			{
+				const auto head = head_.load(std::memory_order_relaxed);
+				return slots_[head & mask_].Sequence.load(std::memory_order_acquire) != head + 1;
+			}
+
+			/**
+			 * Fügt ein Element hinzu. Darf von beliebig vielen Threads gleichzeitig aufgerufen werden.
+			 *
+			 * \param item
+			 * \return false, falls die Warteschlange voll ist
+			 */
+			bool TryPush(const T &item)
+			{
+				return Emplace(item);
+			}
+			/**
+			 * Fügt ein Element hinzu. Darf von beliebig vielen Threads gleichzeitig aufgerufen werden.
+			 *
+			 * \param item
+			 * \return false, falls die Warteschlange voll ist
+			 */
+			bool TryPush(T &&item)
+			{
+				return Emplace(std::move(item));
+			}
+			/**
+			 * Entnimmt das älteste Element. Darf nur von einem Thread aufgerufen werden.
+			 *
+			 * \param item nimmt das Element auf
+			 * \return false, falls die Warteschlange leer ist
+			 */
+			bool TryPop(T &item)
+			{
+				const auto head = head_.load(std::memory_order_relaxed);
+				auto &slot = slots_[head & mask_];
+				if (slot.Sequence.load(std::memory_order_acquire) != head + 1)
+				{
+					return false;
+				}
+
+				auto value = reinterpret_cast<T*>(&slot.Storage);
+				item = std::move(*value);
+				value->~T();
+
+				slot.Sequence.store(head + mask_ + 1, std::memory_order_release);
+				head_.store(head + 1, std::memory_order_relaxed);
+
+				return true;
+			}
+
+		private:
+			//copying prohibited
+			MpscQueue(const MpscQueue&);
+			void operator=(const MpscQueue&);
+
+			static const std::size_t CacheLineSize = 64;
+
+			struct Slot
+			{
+				std::atomic<std::size_t> Sequence;
+				typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type Storage;
+			};
+
+			template<typename U>
+			bool Emplace(U &&item)
+			{
+				auto tail = tail_.load(std::memory_order_relaxed);
+				for (;;)
+				{
+					auto &slot = slots_[tail & mask_];
+					const auto sequence = slot.Sequence.load(std::memory_order_acquire);
+					const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(tail);
+					if (difference == 0)
+					{
+						if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+						{
+							new (&slot.Storage) T(std::forward<U>(item));
+							slot.Sequence.store(tail + 1, std::memory_order_release);
+							return true;
+						}
+					}
+					else if (difference < 0)
+					{
+						//der Leser hat diesen Platz noch nicht freigegeben
+						return false;
+					}
+					else
+					{
+						tail = tail_.load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+			std::unique_ptr<Slot[]> slots_;
+			const std::size_t mask_;
+
+			//Schreiber und Leser sollen sich keine Cache-Line teilen
+			char padding0_[CacheLineSize];
+			std::atomic<std::size_t> tail_;
+			char padding1_[CacheLineSize - sizeof(std::atomic<std::size_t>)];
+			std::atomic<std::size_t> head_;
+			char padding2_[CacheLineSize - sizeof(std::atomic<std::size_t>)];
+		};
+	}
+}
+
+#endif
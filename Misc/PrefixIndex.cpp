@@ -0,0 +1,153 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "PrefixIndex.hpp"
+#include <algorithm>
+#include <cctype>
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		//---------------------------------------------------------------------------
+		//Getter/Setter
+		//---------------------------------------------------------------------------
+		int PrefixIndex::GetCount() const
+		{
+			return static_cast<int>(entries_.size());
+		}
+		//---------------------------------------------------------------------------
+		//Runtime-Functions
+		//---------------------------------------------------------------------------
+		AnsiString PrefixIndex::MakeKey(const AnsiString &text)
+		{
+			AnsiString key(text);
+			std::transform(std::begin(key), std::end(key), std::begin(key), [](AnsiChar c)
+			{
+				return static_cast<AnsiChar>(std::tolower(static_cast<unsigned char>(c)));
+			});
+			return key;
+		}
+		//---------------------------------------------------------------------------
+		bool PrefixIndex::StartsWith(const AnsiString &text, const AnsiString &prefix)
+		{
+			return text.length() >= prefix.length() && MakeKey(text.substr(0, prefix.length())) == MakeKey(prefix);
+		}
+		//---------------------------------------------------------------------------
+		void PrefixIndex::Insert(Handle handle, const AnsiString &text)
+		{
+			if (handles_.find(handle) != std::end(handles_))
+			{
+				Update(handle, text);
+				return;
+			}
+
+			handles_[handle] = entries_.insert(std::make_pair(MakeKey(text), handle));
+		}
+		//---------------------------------------------------------------------------
+		void PrefixIndex::Remove(Handle handle)
+		{
+			const auto it = handles_.find(handle);
+			if (it == std::end(handles_))
+			{
+				return;
+			}
+
+			entries_.erase(it->second);
+			handles_.erase(it);
+		}
+		//---------------------------------------------------------------------------
+		void PrefixIndex::Update(Handle handle, const AnsiString &text)
+		{
+			const auto it = handles_.find(handle);
+			if (it == std::end(handles_))
+			{
+				Insert(handle, text);
+				return;
+			}
+
+			auto key = MakeKey(text);
+			if (it->second->first != key)
+			{
+				entries_.erase(it->second);
+				it->second = entries_.insert(std::make_pair(std::move(key), handle));
+			}
+		}
+		//---------------------------------------------------------------------------
+		void PrefixIndex::Clear()
+		{
+			entries_.clear();
+			handles_.clear();
+		}
+		//---------------------------------------------------------------------------
+		void PrefixIndex::GetPrefixRange(const AnsiString &key, EntryMap::const_iterator &first, EntryMap::const_iterator &last) const
+		{
+			first = entries_.lower_bound(key);
+
+			//der kleinste Schlüssel, der nicht mehr mit dem Präfix beginnt
+			auto end = key;
+			while (!end.empty() && static_cast<unsigned char>(end.back()) == 0xFF)
+			{
+				end.pop_back();
+			}
+			if (end.empty())
+			{
+				last = entries_.end();
+				return;
+			}
+			end.back() = static_cast<AnsiChar>(static_cast<unsigned char>(end.back()) + 1);
+
+			last = entries_.lower_bound(end);
+		}
+		//---------------------------------------------------------------------------
+		PrefixIndex::Handle PrefixIndex::FindNext(const AnsiString &prefix, Handle current) const
+		{
+			const auto key = MakeKey(prefix);
+
+			EntryMap::const_iterator first, last;
+			GetPrefixRange(key, first, last);
+			if (first == last)
+			{
+				return nullptr;
+			}
+
+			if (current != nullptr)
+			{
+				const auto it = handles_.find(current);
+				if (it != std::end(handles_) && it->second->first.compare(0, key.length(), key) == 0)
+				{
+					EntryMap::const_iterator next = it->second;
+					if (++next != last)
+					{
+						return next->second;
+					}
+				}
+			}
+
+			return first->second;
+		}
+		//---------------------------------------------------------------------------
+		PrefixIndex::Handle PrefixIndex::FindFirst(const AnsiString &prefix) const
+		{
+			return FindNext(prefix, nullptr);
+		}
+		//---------------------------------------------------------------------------
+		std::vector<PrefixIndex::Handle> PrefixIndex::FindEqual(const AnsiString &text) const
+		{
+			std::vector<Handle> handles;
+
+			const auto range = entries_.equal_range(MakeKey(text));
+			for (auto it = range.first; it != range.second; ++it)
+			{
+				handles.push_back(it->second);
+			}
+			return handles;
+		}
+		//---------------------------------------------------------------------------
+	}
+}
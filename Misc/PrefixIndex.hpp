@@ -0,0 +1,110 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_MISC_PREFIXINDEX_HPP
+#define OSHGUI_MISC_PREFIXINDEX_HPP
+
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include "Strings.hpp"
+#include "../Exports.hpp"
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		/**
+		 * Sortierter Index über die Texte einer Liste. Erlaubt die Suche nach einem
+		 * Präfix (ohne Beachtung der Groß-/Kleinschreibung) in O(log n).
+		 * Die Einträge verweisen auf stabile Handles statt auf Listenpositionen, Einfügen und
+		 * Entfernen ändern daher nur den betroffenen Eintrag.
+		 */
+		class OSHGUI_EXPORT PrefixIndex
+		{
+		public:
+			typedef const void* Handle;
+
+			/**
+			 * Fügt einen Eintrag hinzu.
+			 *
+			 * \param handle
+			 * \param text
+			 */
+			void Insert(Handle handle, const AnsiString &text);
+			/**
+			 * Entfernt den Eintrag. Der Text wird nicht benötigt und darf sich inzwischen geändert haben.
+			 *
+			 * \param handle
+			 */
+			void Remove(Handle handle);
+			/**
+			 * Sortiert den Eintrag nach einer Änderung seines Texts neu ein.
+			 *
+			 * \param handle
+			 * \param text der neue Text
+			 */
+			void Update(Handle handle, const AnsiString &text);
+			/**
+			 * Entfernt alle Einträge.
+			 */
+			void Clear();
+			/**
+			 * Ruft die Anzahl der Einträge ab.
+			 *
+			 * \return count
+			 */
+			int GetCount() const;
+
+			/**
+			 * Sucht den Eintrag, der in alphabetischer Reihenfolge nach dem aktuellen Eintrag als
+			 * nächstes mit dem Präfix beginnt. Am Ende wird wieder von vorne begonnen.
+			 *
+			 * \param prefix
+			 * \param current der aktuelle Eintrag oder nullptr
+			 * \return der gefundene Eintrag oder nullptr
+			 */
+			Handle FindNext(const AnsiString &prefix, Handle current) const;
+			/**
+			 * Sucht den alphabetisch ersten Eintrag, der mit dem Präfix beginnt.
+			 *
+			 * \param prefix
+			 * \return der gefundene Eintrag oder nullptr
+			 */
+			Handle FindFirst(const AnsiString &prefix) const;
+			/**
+			 * Sucht alle Einträge, deren Text ohne Beachtung der Groß-/Kleinschreibung dem Text entspricht.
+			 *
+			 * \param text
+			 * \return die gefundenen Einträge in der Reihenfolge ihres Einfügens
+			 */
+			std::vector<Handle> FindEqual(const AnsiString &text) const;
+
+			/**
+			 * Prüft, ob der Text mit dem Präfix beginnt. Die Groß-/Kleinschreibung wird nicht beachtet.
+			 *
+			 * \param text
+			 * \param prefix
+			 * \return ja / nein
+			 */
+			static bool StartsWith(const AnsiString &text, const AnsiString &prefix);
+
+		private:
+			typedef std::multimap<AnsiString, Handle> EntryMap;
+
+			static AnsiString MakeKey(const AnsiString &text);
+
+			void GetPrefixRange(const AnsiString &key, EntryMap::const_iterator &first, EntryMap::const_iterator &last) const;
+
+			EntryMap entries_;
+			std::unordered_map<Handle, EntryMap::iterator> handles_;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,216 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_MISC_SMALLVECTOR_HPP
+#define OSHGUI_MISC_SMALLVECTOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		/**
+		 * Dynamisches Array, das bis zu InlineCapacity Elemente ohne Heap-Allokation direkt im
+		 * Objekt ablegt. Erst wenn mehr Elemente benötigt werden, wird Speicher angefordert.
+		 * Die Elemente werden mit memcpy verschoben und müssen daher trivial kopierbar sein.
+		 */
+		template<typename T, std::size_t InlineCapacity>
+		class SmallVector
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+			static_assert(InlineCapacity > 0, "InlineCapacity must not be 0");
+
+		public:
+			typedef T value_type;
+			typedef std::size_t size_type;
+			typedef T& reference;
+			typedef const T& const_reference;
+			typedef T* iterator;
+			typedef const T* const_iterator;
+			typedef std::reverse_iterator<iterator> reverse_iterator;
+			typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+			SmallVector()
+				: data_(GetInlineData()),
+				  size_(0),
+				  capacity_(InlineCapacity)
+			{
+
+			}
+			SmallVector(const SmallVector &other)
+				: data_(GetInlineData()),
+				  size_(0),
+				  capacity_(InlineCapacity)
+			{
+				Assign(other);
+			}
+			SmallVector(SmallVector &&other)
+				: data_(GetInlineData()),
+				  size_(0),
+				  capacity_(InlineCapacity)
+			{
+				Steal(other);
+			}
+			~SmallVector()
+			{
+				Release();
+			}
+
+			SmallVector& operator=(const SmallVector &other)
+			{
+				if (this != &other)
+				{
+					size_ = 0;
+					Assign(other);
+				}
+				return *this;
+			}
+			SmallVector& operator=(SmallVector &&other)
+			{
+				if (this != &other)
+				{
+					Release();
+					Steal(other);
+				}
+				return *this;
+			}
+
+			iterator begin() { return data_; }
+			const_iterator begin() const { return data_; }
+			iterator end() { return data_ + size_; }
+			const_iterator end() const { return data_ + size_; }
+			reverse_iterator rbegin() { return reverse_iterator(end()); }
+			const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+			reverse_iterator rend() { return reverse_iterator(begin()); }
+			const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+			size_type size() const { return size_; }
+			size_type capacity() const { return capacity_; }
+			bool empty() const { return size_ == 0; }
+
+			reference operator[](size_type index) { return data_[index]; }
+			const_reference operator[](size_type index) const { return data_[index]; }
+			reference front() { return data_[0]; }
+			const_reference front() const { return data_[0]; }
+			reference back() { return data_[size_ - 1]; }
+			const_reference back() const { return data_[size_ - 1]; }
+
+			void reserve(size_type capacity)
+			{
+				if (capacity > capacity_)
+				{
+					auto data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+					std::memcpy(data, data_, size_ * sizeof(T));
+					if (!IsInline())
+					{
+						::operator delete(data_);
+					}
+					data_ = data;
+					capacity_ = capacity;
+				}
+			}
+
+			void push_back(const T &value)
+			{
+				insert(end(), value);
+			}
+			void push_front(const T &value)
+			{
+				insert(begin(), value);
+			}
+			iterator insert(const_iterator position, const T &value)
+			{
+				const auto index = static_cast<size_type>(position - data_);
+				//value könnte auf ein Element dieses Arrays verweisen
+				const T copy(value);
+				if (size_ == capacity_)
+				{
+					reserve(capacity_ * 2);
+				}
+				std::memmove(data_ + index + 1, data_ + index, (size_ - index) * sizeof(T));
+				data_[index] = copy;
+				++size_;
+				return data_ + index;
+			}
+			iterator erase(const_iterator position)
+			{
+				return erase(position, position + 1);
+			}
+			iterator erase(const_iterator first, const_iterator last)
+			{
+				const auto index = static_cast<size_type>(first - data_);
+				const auto count = static_cast<size_type>(last - first);
+				std::memmove(data_ + index, data_ + index + count, (size_ - index - count) * sizeof(T));
+				size_ -= count;
+				return data_ + index;
+			}
+			void pop_back()
+			{
+				--size_;
+			}
+			void clear()
+			{
+				size_ = 0;
+			}
+
+		private:
+			T* GetInlineData()
+			{
+				return reinterpret_cast<T*>(&storage_);
+			}
+			bool IsInline() const
+			{
+				return data_ == reinterpret_cast<const T*>(&storage_);
+			}
+			void Release()
+			{
+				if (!IsInline())
+				{
+					::operator delete(data_);
+				}
+				data_ = GetInlineData();
+				size_ = 0;
+				capacity_ = InlineCapacity;
+			}
+			void Assign(const SmallVector &other)
+			{
+				reserve(other.size_);
+				std::memcpy(data_, other.data_, other.size_ * sizeof(T));
+				size_ = other.size_;
+			}
+			void Steal(SmallVector &other)
+			{
+				if (other.IsInline())
+				{
+					Assign(other);
+				}
+				else
+				{
+					data_ = other.data_;
+					size_ = other.size_;
+					capacity_ = other.capacity_;
+
+					other.data_ = other.GetInlineData();
+					other.capacity_ = InlineCapacity;
+				}
+				other.size_ = 0;
+			}
+
+			typename std::aligned_storage<sizeof(T) * InlineCapacity, std::alignment_of<T>::value>::type storage_;
+			T *data_;
+			size_type size_;
+			size_type capacity_;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,188 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_MISC_SPATIALGRID_HPP
+#define OSHGUI_MISC_SPATIALGRID_HPP
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+
+#include "../Drawing/Point.hpp"
+#include "../Drawing/Rectangle.hpp"
+
+namespace OSHGui
+{
+	namespace Misc
+	{
+		/**
+		 * Gleichmäßiges Raster, das Elemente anhand ihres umschließenden Rechtecks
+		 * einsortiert und schnelle Abfragen nach Punkten ermöglicht.
+		 */
+		template<typename T>
+		class SpatialGrid
+		{
+		public:
+			static const int DefaultCellSize = 64;
+
+			/**
+			 * Konstruktor der Klasse.
+			 *
+			 * \param cellSize Kantenlänge einer Zelle
+			 */
+			explicit SpatialGrid(int cellSize = DefaultCellSize)
+				: cellSize_(cellSize > 0 ? cellSize : DefaultCellSize)
+			{
+
+			}
+
+			/**
+			 * Fügt das Element ein oder aktualisiert dessen Rechteck. Leere Rechtecke entfernen das Element.
+			 *
+			 * \param item
+			 * \param bounds
+			 */
+			void Update(const T &item, const Drawing::RectangleI &bounds)
+			{
+				if (bounds.GetWidth() <= 0 || bounds.GetHeight() <= 0)
+				{
+					Remove(item);
+					return;
+				}
+
+				auto it = bounds_.find(item);
+				if (it != std::end(bounds_))
+				{
+					if (it->second.GetLocation() == bounds.GetLocation() && it->second.GetSize() == bounds.GetSize())
+					{
+						return;
+					}
+
+					RemoveFromCells(item, it->second);
+					it->second = bounds;
+				}
+				else
+				{
+					bounds_.emplace(item, bounds);
+				}
+
+				ForEachCell(bounds, [&](std::vector<T> &cell)
+				{
+					cell.push_back(item);
+				});
+			}
+			/**
+			 * Entfernt das Element aus dem Raster.
+			 *
+			 * \param item
+			 */
+			void Remove(const T &item)
+			{
+				auto it = bounds_.find(item);
+				if (it != std::end(bounds_))
+				{
+					RemoveFromCells(item, it->second);
+					bounds_.erase(it);
+				}
+			}
+			/**
+			 * Ruft alle Elemente ab, deren Rechteck den Punkt enthält.
+			 *
+			 * \param point
+			 * \param result wird vorher geleert
+			 */
+			void Query(const Drawing::PointI &point, std::vector<T> &result) const
+			{
+				result.clear();
+
+				auto it = cells_.find(MakeKey(CellIndex(point.X), CellIndex(point.Y)));
+				if (it == std::end(cells_))
+				{
+					return;
+				}
+
+				for (auto &item : it->second)
+				{
+					if (bounds_.find(item)->second.Contains(point))
+					{
+						result.push_back(item);
+					}
+				}
+			}
+			/**
+			 * Entfernt alle Elemente.
+			 */
+			void Clear()
+			{
+				cells_.clear();
+				bounds_.clear();
+			}
+
+		private:
+			int CellIndex(int value) const
+			{
+				//abrunden, damit negative Koordinaten korrekt einsortiert werden
+				return value >= 0 ? value / cellSize_ : -((-value - 1) / cellSize_) - 1;
+			}
+
+			static std::int64_t MakeKey(int x, int y)
+			{
+				return (static_cast<std::int64_t>(x) << 32) | static_cast<std::uint32_t>(y);
+			}
+
+			template<typename Func>
+			void ForEachCell(const Drawing::RectangleI &bounds, Func func)
+			{
+				const auto left = CellIndex(bounds.GetLeft());
+				const auto top = CellIndex(bounds.GetTop());
+				const auto right = CellIndex(bounds.GetRight() - 1);
+				const auto bottom = CellIndex(bounds.GetBottom() - 1);
+
+				for (auto y = top; y <= bottom; ++y)
+				{
+					for (auto x = left; x <= right; ++x)
+					{
+						func(cells_[MakeKey(x, y)]);
+					}
+				}
+			}
+
+			void RemoveFromCells(const T &item, const Drawing::RectangleI &bounds)
+			{
+				const auto left = CellIndex(bounds.GetLeft());
+				const auto top = CellIndex(bounds.GetTop());
+				const auto right = CellIndex(bounds.GetRight() - 1);
+				const auto bottom = CellIndex(bounds.GetBottom() - 1);
+
+				for (auto y = top; y <= bottom; ++y)
+				{
+					for (auto x = left; x <= right; ++x)
+					{
+						auto it = cells_.find(MakeKey(x, y));
+						if (it != std::end(cells_))
+						{
+							auto &cell = it->second;
+							cell.erase(std::remove(std::begin(cell), std::end(cell), item), std::end(cell));
+							if (cell.empty())
+							{
+								cells_.erase(it);
+							}
+						}
+					}
+				}
+			}
+
+			int cellSize_;
+			std::unordered_map<std::int64_t, std::vector<T>> cells_;
+			std::unordered_map<T, Drawing::RectangleI> bounds_;
+		};
+	}
+}
+
+#endif
@@ -1,67 +1,79 @@
-/*
- * OldSchoolHack GUI
- *
- * by KN4CK3R https://www.oldschoolhack.me/
- *
- * MIT License
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in
- * all copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
- * THE SOFTWARE.
- */
-
-#include "Application.hpp"
-
-#include "Misc/Exceptions.hpp"
-
-#include "Drawing/Point.hpp"
-#include "Drawing/Size.hpp"
-#include "Drawing/Rectangle.hpp"
-
-#include "Misc/TimeSpan.hpp"
-#include "Misc/DateTime.hpp"
-
-#include "Event/Event.hpp"
-
-#include "Cursor/Cursors.hpp"
-
-#include "Drawing/FontManager.hpp"
-
-#include "Controls/Control.hpp"
-#include "Controls/Label.hpp"
-#include "Controls/LinkLabel.hpp"
-#include "Controls/Button.hpp"
-#include "Controls/CheckBox.hpp"
-#include "Controls/RadioButton.hpp"
-#include "Controls/ComboBox.hpp"
-#include "Controls/Panel.hpp"
-#include "Controls/Form.hpp"
-#include "Controls/GroupBox.hpp"
-#include "Controls/ListBox.hpp"
-#include "Controls/ProgressBar.hpp"
-#include "Controls/TrackBar.hpp"
-#include "Controls/TextBox.hpp"
-#include "Controls/Timer.hpp"
-#include "Controls/TabControl.hpp"
-#include "Controls/TabPage.hpp"
-#include "Controls/PictureBox.hpp"
-#include "Controls/ColorPicker.hpp"
-#include "Controls/ColorBar.hpp"
-#include "Controls/ScrollBar.hpp"
-#include "Controls/HotkeyControl.hpp"
-
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Application.hpp"
+
+#include "Misc/Exceptions.hpp"
+
+#include "Drawing/Point.hpp"
+#include "Drawing/Size.hpp"
+#include "Drawing/Rectangle.hpp"
+
+#include "Misc/TimeSpan.hpp"
+#include "Misc/DateTime.hpp"
+#include "Misc/Clock.hpp"
+
+#include "Event/Event.hpp"
+
+#include "Animation/Easing.hpp"
+#include "Animation/Tween.hpp"
+#include "Animation/Timeline.hpp"
+
+#include "Cursor/Cursors.hpp"
+
+#include "Drawing/FontManager.hpp"
+#include "Drawing/FontLocator.hpp"
+#include "Drawing/GlyphAtlasCache.hpp"
+#include "Drawing/Theme.hpp"
+
+#include "Controls/Control.hpp"
+#include "Controls/LayoutEngine.hpp"
+#include "Controls/Label.hpp"
+#include "Controls/LinkLabel.hpp"
+#include "Controls/Button.hpp"
+#include "Controls/CheckBox.hpp"
+#include "Controls/RadioButton.hpp"
+#include "Controls/ComboBox.hpp"
+#include "Controls/Panel.hpp"
+#include "Controls/Form.hpp"
+#include "Controls/GroupBox.hpp"
+#include "Controls/ListBox.hpp"
+#include "Controls/ListView.hpp"
+#include "Controls/ProgressBar.hpp"
+#include "Controls/TrackBar.hpp"
+#include "Controls/TextBox.hpp"
+#include "Controls/MultiLineTextBox.hpp"
+#include "Controls/Timer.hpp"
+#include "Controls/TabControl.hpp"
+#include "Controls/TabPage.hpp"
+#include "Controls/PictureBox.hpp"
+#include "Controls/ColorPicker.hpp"
+#include "Controls/ColorBar.hpp"
+#include "Controls/ScrollBar.hpp"
+#include "Controls/ScrollPanel.hpp"
+#include "Controls/HotkeyControl.hpp"
+
 #include "Controls/MessageBox.hpp"
\ No newline at end of file
@@ -0,0 +1,108 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#include "TimerScheduler.hpp"
+#include "Controls/Control.hpp"
+#include <algorithm>
+
+namespace OSHGui
+{
+	//---------------------------------------------------------------------------
+	//Constructor
+	//---------------------------------------------------------------------------
+	TimerScheduler::TimerScheduler()
+		: sequence_(0)
+	{
+
+	}
+	//---------------------------------------------------------------------------
+	//Runtime-Functions
+	//---------------------------------------------------------------------------
+	void TimerScheduler::Schedule(Control *control, const Misc::Clock::TimePoint &deadline)
+	{
+		const auto sequence = ++sequence_;
+
+		//alte Einträge bleiben im Heap und werden beim Entnehmen verworfen
+		active_[control] = sequence;
+
+		Entry entry = { deadline, sequence, control };
+		heap_.push_back(entry);
+		std::push_heap(std::begin(heap_), std::end(heap_), EntryCompare());
+
+		if (heap_.size() > active_.size() * 2 + 32)
+		{
+			Compact();
+		}
+	}
+	//---------------------------------------------------------------------------
+	void TimerScheduler::Cancel(Control *control)
+	{
+		active_.erase(control);
+	}
+	//---------------------------------------------------------------------------
+	bool TimerScheduler::IsScheduled(Control *control) const
+	{
+		return active_.find(control) != std::end(active_);
+	}
+	//---------------------------------------------------------------------------
+	void TimerScheduler::Process(const Misc::Clock::TimePoint &now)
+	{
+		//erst alle fälligen Einträge entnehmen, ein erneut geplanter Zeitpunkt <= now wird so erst im nächsten Durchlauf ausgeführt
+		due_.clear();
+		while (!heap_.empty() && heap_.front().Deadline <= now)
+		{
+			due_.push_back(heap_.front());
+			std::pop_heap(std::begin(heap_), std::end(heap_), EntryCompare());
+			heap_.pop_back();
+		}
+
+		for (auto &entry : due_)
+		{
+			//zwischenzeitlich abgebrochen, neu geplant oder zerstört
+			auto it = active_.find(entry.Target);
+			if (it == std::end(active_) || it->second != entry.Sequence)
+			{
+				continue;
+			}
+			active_.erase(it);
+
+			entry.Target->InjectTime(now);
+		}
+	}
+	//---------------------------------------------------------------------------
+	void TimerScheduler::Shift(const Misc::Clock::Duration &offset)
+	{
+		//eine gleichmäßige Verschiebung erhält die Heap-Ordnung
+		for (auto &entry : heap_)
+		{
+			entry.Deadline += offset;
+		}
+	}
+	//---------------------------------------------------------------------------
+	void TimerScheduler::Compact()
+	{
+		heap_.erase(std::remove_if(std::begin(heap_), std::end(heap_), [this](const Entry &entry)
+		{
+			auto it = active_.find(entry.Target);
+			return it == std::end(active_) || it->second != entry.Sequence;
+		}), std::end(heap_));
+
+		std::make_heap(std::begin(heap_), std::end(heap_), EntryCompare());
+	}
+	//---------------------------------------------------------------------------
+	bool TimerScheduler::EntryCompare::operator()(const Entry &lhs, const Entry &rhs) const
+	{
+		//std::push_heap baut einen Max-Heap, deshalb umgekehrt vergleichen
+		if (lhs.Deadline != rhs.Deadline)
+		{
+			return lhs.Deadline > rhs.Deadline;
+		}
+		return lhs.Sequence > rhs.Sequence;
+	}
+	//---------------------------------------------------------------------------
+}
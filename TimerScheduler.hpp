@@ -0,0 +1,88 @@
+/*
+ * OldSchoolHack GUI
+ *
+ * by KN4CK3R https://www.oldschoolhack.me/
+ *
+ * See license in OSHGui.hpp
+ */
+
+#ifndef OSHGUI_TIMERSCHEDULER_HPP
+#define OSHGUI_TIMERSCHEDULER_HPP
+
+#include <vector>
+#include <unordered_map>
+#include "Exports.hpp"
+#include "Misc/Clock.hpp"
+
+namespace OSHGui
+{
+	class Control;
+
+	/**
+	 * Verwaltet die Zeitpunkte, zu denen Steuerelemente über InjectTime benachrichtigt
+	 * werden wollen. Pro Frame werden nur die fälligen Einträge abgearbeitet.
+	 */
+	class OSHGUI_EXPORT TimerScheduler
+	{
+	public:
+		/**
+		 * Konstruktor der Klasse.
+		 */
+		TimerScheduler();
+
+		/**
+		 * Plant den Aufruf von InjectTime für das Steuerelement. Ein bereits
+		 * geplanter Zeitpunkt wird dabei ersetzt.
+		 *
+		 * \param control
+		 * \param deadline
+		 */
+		void Schedule(Control *control, const Misc::Clock::TimePoint &deadline);
+		/**
+		 * Entfernt den geplanten Aufruf für das Steuerelement.
+		 *
+		 * \param control
+		 */
+		void Cancel(Control *control);
+		/**
+		 * Ruft ab, ob für das Steuerelement ein Aufruf geplant ist.
+		 *
+		 * \param control
+		 * \return ja / nein
+		 */
+		bool IsScheduled(Control *control) const;
+		/**
+		 * Ruft InjectTime für alle Steuerelemente auf, deren Zeitpunkt erreicht ist.
+		 *
+		 * \param now die aktuelle Zeit
+		 */
+		void Process(const Misc::Clock::TimePoint &now);
+		/**
+		 * Verschiebt alle geplanten Zeitpunkte, z.B. nach einem Wechsel der Zeitquelle.
+		 *
+		 * \param offset
+		 */
+		void Shift(const Misc::Clock::Duration &offset);
+
+	private:
+		struct Entry
+		{
+			Misc::Clock::TimePoint Deadline;
+			unsigned long long Sequence;
+			Control *Target;
+		};
+		struct EntryCompare
+		{
+			bool operator()(const Entry &lhs, const Entry &rhs) const;
+		};
+
+		void Compact();
+
+		std::vector<Entry> heap_;
+		std::vector<Entry> due_;
+		std::unordered_map<Control*, unsigned long long> active_;
+		unsigned long long sequence_;
+	};
+}
+
+#endif